@@ -4,6 +4,9 @@
 
 #include <cstddef>
 #include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "format.hpp"
 #include "tuple.hpp"
@@ -11,11 +14,14 @@
 #include "unevaluated.hpp"
 #include "upd.hpp"
 
-#include "detail/function_reference.hpp"
+#include "detail/encoding.hpp"
+#include "detail/io/byte_stream.hpp"
 #include "detail/io/immediate_process.hpp"
 #include "detail/static_error.hpp"
 #include "detail/type_traits/flatten_tuple.hpp"
+#include "detail/type_traits/index_sequence.hpp"
 #include "detail/type_traits/input_tuple.hpp"
+#include "detail/type_traits/remove_cv_ref.hpp"
 #include "detail/type_traits/require.hpp"
 #include "detail/type_traits/signature.hpp"
 
@@ -25,47 +31,166 @@ namespace upd {
 namespace detail {
 
 //! \brief Byte getter with erased type
-using src_t = abstract_function<byte_t()>;
+using src_t = byte_source;
 
 //! \brief Byte putter with erased type
-using dest_t = abstract_function<void(byte_t)>;
+using dest_t = byte_sink;
 
-//! \brief Serialize `value` as a sequence of byte then call `dest` on every byte of that sequence
-template<endianess Endianess, signed_mode Signed_Mode, typename T, UPD_REQUIREMENT(not_tuple, T)>
-void insert(dest_t &dest, const T &value) {
-  using namespace upd;
+//! \name
+//! \brief Make a tuple holding every value of the response to an action returning `value`
+//!
+//! The elements of `std::tuple` and `std::pair` instances are serialized one after the other and \ref<tuple> tuple
+//! instances are returned as is.
+//! @{
 
-  auto output = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, value);
-  for (byte_t byte : output)
-    dest(byte);
+template<endianess Endianess, signed_mode Signed_Mode, typename T>
+tuple<Endianess, Signed_Mode, T> make_response_tuple(const T &value) {
+  return tuple<Endianess, Signed_Mode, T>{value};
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         endianess Endianess_Tuple,
+         signed_mode Signed_Mode_Tuple,
+         typename... Ts>
+const tuple<Endianess_Tuple, Signed_Mode_Tuple, Ts...> &
+make_response_tuple(const tuple<Endianess_Tuple, Signed_Mode_Tuple, Ts...> &value) {
+  return value;
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename... Ts, std::size_t... Is>
+flatten_tuple_t<Endianess, Signed_Mode, std::tuple<Ts...>> make_response_tuple(const std::tuple<Ts...> &value,
+                                                                               index_sequence<Is...>) {
+  return flatten_tuple_t<Endianess, Signed_Mode, std::tuple<Ts...>>{std::get<Is>(value)...};
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+flatten_tuple_t<Endianess, Signed_Mode, std::tuple<Ts...>> make_response_tuple(const std::tuple<Ts...> &value) {
+  return make_response_tuple<Endianess, Signed_Mode>(value, make_index_sequence<sizeof...(Ts)>{});
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, typename U>
+flatten_tuple_t<Endianess, Signed_Mode, std::pair<T, U>> make_response_tuple(const std::pair<T, U> &value) {
+  return flatten_tuple_t<Endianess, Signed_Mode, std::pair<T, U>>{value.first, value.second};
+}
+
+//! @}
+
+//! \name
+//! \brief Get the value returned by an action from the tuple holding every value of its response
+//!
+//! This is the inverse of `make_response_tuple`. The second parameter is only used to select the returned type.
+//! @{
+
+template<typename Tuple, typename T>
+T from_response_tuple(const Tuple &values, T *) {
+  return values.template get<0>();
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+tuple<Endianess, Signed_Mode, Ts...> from_response_tuple(const tuple<Endianess, Signed_Mode, Ts...> &values,
+                                                         tuple<Endianess, Signed_Mode, Ts...> *) {
+  return values;
+}
+template<typename Tuple, typename... Ts, std::size_t... Is>
+std::tuple<Ts...> from_response_tuple(const Tuple &values, std::tuple<Ts...> *, index_sequence<Is...>) {
+  return std::tuple<Ts...>{values.template get<Is>()...};
+}
+template<typename Tuple, typename... Ts>
+std::tuple<Ts...> from_response_tuple(const Tuple &values, std::tuple<Ts...> *retval) {
+  return from_response_tuple(values, retval, make_index_sequence<sizeof...(Ts)>{});
+}
+template<typename Tuple, typename T, typename U>
+std::pair<T, U> from_response_tuple(const Tuple &values, std::pair<T, U> *) {
+  return std::pair<T, U>{values.template get<0>(), values.template get<1>()};
+}
+
+//! @}
+
+//! \brief Serialize `value` as a sequence of byte then call `dest` on every byte of that sequence
+//!
+//! If `value` is a `std::tuple`, `std::pair` or \ref<tuple> tuple instance, each of its elements is serialized.
+template<endianess Endianess, signed_mode Signed_Mode, integer_encoding Integer_Encoding, typename T, typename Dest>
+void insert(Dest &dest, const T &value) {
+  write_fields<Integer_Encoding>(make_response_tuple<Endianess, Signed_Mode>(value), dest);
 }
 
 //! \brief Invoke `ftor` on the unserialized arguments from `src` and write the serialized return value to `dest`
-template<typename Tuple, typename F>
+template<typename Tuple, integer_encoding Integer_Encoding, typename F>
 void call(src_t &src, F &&ftor) {
-  Tuple input_args;
-  for (auto &byte : input_args)
-    byte = src();
+  Tuple input_args{uninitialized};
+  read_fields<Integer_Encoding>(input_args, src);
   input_args.invoke(FWD(ftor));
 }
 
 //! \copydoc call
-template<typename Tuple, typename F, UPD_REQUIREMENT(is_void, detail::return_t<F>)>
-void call(src_t &src, dest_t &, F &&ftor) {
-  Tuple input_args;
-  for (auto &byte : input_args)
-    byte = src();
+//!
+//! `src` and `dest` are either type-erased or, when the callback is known at compile time, the byte getter and putter
+//! themselves, so that reading the arguments and writing the return value can be inlined.
+template<typename Tuple,
+         integer_encoding Integer_Encoding,
+         typename F,
+         typename Src,
+         typename Dest,
+         UPD_REQUIREMENT(is_void, detail::return_t<F>)>
+void call(Src &src, Dest &, F &&ftor) {
+  Tuple input_args{uninitialized};
+  read_fields<Integer_Encoding>(input_args, src);
   input_args.invoke(UPD_FWD(ftor));
 }
 
 //! \copydoc call
-template<typename Tuple, typename F, UPD_REQUIREMENT(not_void, detail::return_t<F>)>
-void call(src_t &src, dest_t &dest, F &&ftor) {
-  Tuple input_args;
-  for (auto &byte : input_args)
-    byte = src();
+template<typename Tuple,
+         integer_encoding Integer_Encoding,
+         typename F,
+         typename Src,
+         typename Dest,
+         UPD_REQUIREMENT(not_void, detail::return_t<F>)>
+void call(Src &src, Dest &dest, F &&ftor) {
+  Tuple input_args{uninitialized};
+  read_fields<Integer_Encoding>(input_args, src);
+
+  return insert<Tuple::storage_endianess, Tuple::storage_signed_mode, Integer_Encoding>(
+      dest, input_args.invoke(UPD_FWD(ftor)));
+}
 
-  return insert<Tuple::storage_endianess, Tuple::storage_signed_mode>(dest, input_args.invoke(UPD_FWD(ftor)));
+//! \name
+//! \brief Implementation of `call_in_place`
+//! @{
+
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         typename F,
+         UPD_REQUIREMENT(is_void, detail::return_t<F>)>
+void call_in_place_impl(const byte_t *input, dest_t &, F &&ftor, std::false_type) {
+  input_tuple_view<const byte_t *, Endianess, Signed_Mode, F>{input}.invoke(UPD_FWD(ftor));
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         typename F,
+         UPD_REQUIREMENT(not_void, detail::return_t<F>)>
+void call_in_place_impl(const byte_t *input, dest_t &dest, F &&ftor, std::false_type) {
+  insert<Endianess, Signed_Mode, Integer_Encoding>(
+      dest, input_tuple_view<const byte_t *, Endianess, Signed_Mode, F>{input}.invoke(UPD_FWD(ftor)));
+}
+template<endianess Endianess, signed_mode Signed_Mode, integer_encoding Integer_Encoding, typename F>
+void call_in_place_impl(const byte_t *input, dest_t &dest, F &&ftor, std::true_type) {
+  iterator_reader<const byte_t *> src{input};
+  call<input_tuple<Endianess, Signed_Mode, F>, Integer_Encoding>(src, dest, UPD_FWD(ftor));
+}
+
+//! @}
+
+//! \brief Invoke `ftor` on the arguments serialized in the contiguous payload starting at `input` and write the
+//! serialized return value to `dest`
+//!
+//! If the length of the payload does not depend on its content, the arguments are unserialized straight from the
+//! payload through a `tuple_view`, without copying it first. Otherwise, the payload is decoded into a `tuple` as in
+//! `call`.
+template<endianess Endianess, signed_mode Signed_Mode, integer_encoding Integer_Encoding, typename F>
+void call_in_place(const byte_t *input, dest_t &dest, F &&ftor) {
+  call_in_place_impl<Endianess, Signed_Mode, Integer_Encoding>(
+      input,
+      dest,
+      UPD_FWD(ftor),
+      is_variable_length_tuple<Integer_Encoding, input_tuple<Endianess, Signed_Mode, F>>{});
 }
 
 //! \brief Implementation of the `action` class behaviour
@@ -81,10 +206,19 @@ struct action_model_impl {
   F ftor;
 };
 
+struct action_access;
+
 //! \brief Abstract class used for setting up type erasure in the `action` class
 struct action_concept {
   virtual ~action_concept() = default;
   virtual void operator()(src_t &&, dest_t &&) = 0;
+  virtual void operator()(const byte_t *, dest_t &&) = 0;
+
+  //! \brief Length of the request payload, given its `size` first bytes
+  //!
+  //! If the length of the payload depends on its content, the returned length is the smallest one which is consistent
+  //! with these bytes. By default, this is the input size of the action.
+  virtual std::size_t request_length(const byte_t *, std::size_t) const { return input_size; }
 
   std::size_t input_size;
   std::size_t output_size;
@@ -96,21 +230,33 @@ struct action_concept {
 //! This class along with the `action_concept` class are internals and meant only to be used within the `action` class
 //! from the public API. When an `action` instance is called, the underlying `action_model` instance calls the managed
 //! callback. The input and output byte streams which the parameters and the return value will be read from or written
-//! to are wrapped into `abstract_function` instances (because virtual functions cannot be templated). Do note however
-//! that unlike `std::function`, constructing `abstract_function` instances do not make use of dynamic allocation and so
-//! does an `action` instance call.
-template<typename F, endianess Endianess, signed_mode Signed_Mode>
+//! to are wrapped into `byte_source` and `byte_sink` instances (because virtual functions cannot be templated). Do note
+//! however that unlike `std::function`, constructing these instances do not make use of dynamic allocation and so does
+//! an `action` instance call. Fixed-length payloads are read and written with a single virtual call, which copies them
+//! at once when the byte streams are iterators.
+template<typename F, endianess Endianess, signed_mode Signed_Mode, integer_encoding Integer_Encoding>
 class action_model : public action_concept {
   using impl_t = action_model_impl<F, Endianess, Signed_Mode>;
   using tuple_t = typename impl_t::tuple_t;
+  using output_tuple_t = flatten_tuple_t<Endianess, Signed_Mode, remove_cv_ref_t<return_t<F>>>;
 
 public:
   explicit action_model(F &&ftor) : m_impl{UPD_FWD(ftor)} {
-    action_model::input_size = tuple_t::size;
-    action_model::output_size = flatten_tuple_t<Endianess, Signed_Mode, return_t<F>>::size;
+    action_model::input_size = encoded_tuple_size<Integer_Encoding, tuple_t>::value;
+    action_model::output_size = encoded_tuple_size<Integer_Encoding, output_tuple_t>::value;
   }
 
-  void operator()(src_t &&src, dest_t &&dest) final { return detail::call<tuple_t>(src, dest, UPD_FWD(m_impl.ftor)); }
+  void operator()(src_t &&src, dest_t &&dest) final {
+    return detail::call<tuple_t, Integer_Encoding>(src, dest, UPD_FWD(m_impl.ftor));
+  }
+
+  void operator()(const byte_t *input, dest_t &&dest) final {
+    return detail::call_in_place<Endianess, Signed_Mode, Integer_Encoding>(input, dest, UPD_FWD(m_impl.ftor));
+  }
+
+  std::size_t request_length(const byte_t *payload, std::size_t size) const final {
+    return detail::request_length<Integer_Encoding, Endianess, Signed_Mode, F>::get(payload, size);
+  }
 
 private:
   impl_t m_impl;
@@ -119,25 +265,38 @@ private:
 //! \brief Wrap a callback with static storage duration or a free function into another free function
 //!
 //! This overload accepts any callback returning `void`.
-template<endianess Endianess, signed_mode Signed_Mode, typename F, F Ftor, UPD_REQUIREMENT(is_void, return_t<F>)>
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         typename F,
+         F Ftor,
+         UPD_REQUIREMENT(is_void, return_t<F>)>
 void static_storage_duration_callback_wrapper(src_t &&src, dest_t &&dest) {
-  input_tuple<Endianess, Signed_Mode, F> parameters_tuple;
-  for (auto &byte : parameters_tuple)
-    byte = src();
+  input_tuple<Endianess, Signed_Mode, F> parameters_tuple{uninitialized};
+  read_fields<Integer_Encoding>(parameters_tuple, src);
   parameters_tuple.invoke(Ftor);
 }
 
 //! \copybrief static_storage_duration_callback_wrapper
 //!
 //! This overload accepts any callback not returning `void`.
-template<endianess Endianess, signed_mode Signed_Mode, typename F, F Ftor, UPD_REQUIREMENT(not_void, return_t<F>)>
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         typename F,
+         F Ftor,
+         UPD_REQUIREMENT(not_void, return_t<F>)>
 void static_storage_duration_callback_wrapper(src_t &&src, dest_t &&dest) {
-  input_tuple<Endianess, Signed_Mode, F> parameters_tuple;
-  for (auto &byte : parameters_tuple)
-    byte = src();
-  auto return_tuple = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, parameters_tuple.invoke(Ftor));
-  for (auto byte : return_tuple)
-    dest(byte);
+  input_tuple<Endianess, Signed_Mode, F> parameters_tuple{uninitialized};
+  read_fields<Integer_Encoding>(parameters_tuple, src);
+  insert<Endianess, Signed_Mode, Integer_Encoding>(dest, parameters_tuple.invoke(Ftor));
+}
+
+//! \brief Wrap a callback with static storage duration or a free function into another free function reading its
+//! arguments from a contiguous payload
+template<endianess Endianess, signed_mode Signed_Mode, integer_encoding Integer_Encoding, typename F, F Ftor>
+void static_storage_duration_in_place_wrapper(const byte_t *input, dest_t &&dest) {
+  call_in_place<Endianess, Signed_Mode, Integer_Encoding>(input, dest, Ftor);
 }
 
 } // namespace detail
@@ -157,7 +316,18 @@ public:
   //! \param ftor Callback to be wrapped
   template<endianess Endianess, signed_mode Signed_Mode, typename F, UPD_REQUIREMENT(invocable, F)>
   explicit action(F &&ftor, endianess_h<Endianess>, signed_mode_h<Signed_Mode>)
-      : m_concept_uptr{new detail::action_model<F, Endianess, Signed_Mode>{UPD_FWD(ftor)}} {}
+      : action{UPD_FWD(ftor), endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, fixed_width} {}
+
+  //! \brief Wrap a copy of a provided callback
+  //! \tparam Endianess, Signed_Mode, Integer_Encoding Serialization parameters
+  //! \param ftor Callback to be wrapped
+  template<endianess Endianess,
+           signed_mode Signed_Mode,
+           integer_encoding Integer_Encoding,
+           typename F,
+           UPD_REQUIREMENT(invocable, F)>
+  explicit action(F &&ftor, endianess_h<Endianess>, signed_mode_h<Signed_Mode>, integer_encoding_h<Integer_Encoding>)
+      : m_concept_uptr{new detail::action_model<F, Endianess, Signed_Mode, Integer_Encoding>{UPD_FWD(ftor)}} {}
 
   UPD_SFINAE_FAILURE_CTOR(action, UPD_ERROR_NOT_INVOCABLE(ftor))
 
@@ -175,7 +345,7 @@ public:
   template<typename Src, typename Dest, UPD_REQUIREMENT(input_invocable, Src), UPD_REQUIREMENT(output_invocable, Dest)>
   void operator()(Src &&src, Dest &&dest) const {
     if (m_concept_uptr)
-      (*m_concept_uptr)(detail::make_function_reference(src), detail::make_function_reference(dest));
+      (*m_concept_uptr)(detail::make_byte_source(src), detail::make_byte_sink(dest));
   }
 
   UPD_SFINAE_FAILURE_MEMBER(operator(), UPD_ERROR_NOT_INPUT(src) " OR " UPD_ERROR_NOT_OUTPUT(dest))
@@ -187,18 +357,71 @@ public:
     operator()(UPD_FWD(input), [](byte_t) {});
   }
 
+  //! \brief Invoke the managed callback on a payload already stored contiguously in memory
+  //!
+  //! Unless the length of the payload depends on its content, the parameters are unserialized straight from `input`
+  //! instead of being copied in a temporary \ref<tuple> tuple first, which saves as much stack space as the payload
+  //! is long.
+  //!
+  //! \param input Beginning of the payload
+  //! \param dest Byte putter
+  template<typename Dest, UPD_REQUIREMENT(output_invocable, Dest)>
+  void call_in_place(const byte_t *input, Dest &&dest) const {
+    if (m_concept_uptr)
+      (*m_concept_uptr)(input, detail::make_byte_sink(dest));
+  }
+
   //! \brief Get the size in bytes of the payload needed to invoke the wrapped callback
+  //!
+  //! With the `integer_encoding::VARINT` encoding, this is the size of the longest possible payload.
+  //!
   //! \return The size of the payload in bytes
   std::size_t input_size() const { return m_concept_uptr->input_size; }
 
   //! \brief Get the size in bytes of the payload representing the return value of the wrapped callback
+  //!
+  //! With the `integer_encoding::VARINT` encoding, this is the size of the longest possible payload.
+  //!
   //! \return The size of the payload in bytes
   std::size_t output_size() const { return m_concept_uptr->output_size; }
 
+  //! \brief Get the size in bytes of a request payload for the wrapped callback, given its `size` first bytes
+  //!
+  //! If the length of the payload depends on its content, the returned size is the smallest one which is consistent
+  //! with these bytes, so it is never greater than the actual size.
+  //!
+  //! \param payload Beginning of the payload
+  //! \param size Number of bytes available from `payload`
+  //! \return The size of the payload in bytes
+  std::size_t request_length(const byte_t *payload, std::size_t size) const {
+    return m_concept_uptr->request_length(payload, size);
+  }
+
 private:
+  friend struct detail::action_access;
+
+  //! \brief Take ownership of an implementation of the `action_concept` interface
+  //!
+  //! This allows actions with a custom behaviour (such as the ones made by `make_delta_action`) to be stored in
+  //! dispatchers like any other action.
+  //!
+  //! \param concept_uptr Owning pointer to the implementation
+  explicit action(std::unique_ptr<detail::action_concept> concept_uptr) : m_concept_uptr{std::move(concept_uptr)} {}
+
   std::unique_ptr<detail::action_concept> m_concept_uptr;
 };
 
+namespace detail {
+
+//! \brief Make \ref<action> action instances out of implementations of the `action_concept` interface
+//!
+//! Only the library may provide such implementations, since they must frame their requests themselves.
+struct action_access {
+  static action make(std::unique_ptr<action_concept> concept_uptr) { return action{std::move(concept_uptr)}; }
+};
+
+} // namespace detail
+
 //! \brief Action which does not manage storage for its underlying callback
 //!
 //! \ref<no_storage_action> no_storage_action instances must be given a free function or a callback with static storage
@@ -213,13 +436,33 @@ public:
   //! \tparam Endianess, Signed_Mode Serialization parameters
   template<typename F, F Ftor, endianess Endianess, signed_mode Signed_Mode>
   explicit no_storage_action(unevaluated<F, Ftor>, endianess_h<Endianess>, signed_mode_h<Signed_Mode>)
-      : m_wrapper{detail::static_storage_duration_callback_wrapper<Endianess, Signed_Mode, F, Ftor>},
-        m_input_size{detail::parameters_size<F>::value}, m_output_size{detail::return_type_size<F>::value} {}
+      : no_storage_action{
+            unevaluated<F, Ftor>{}, endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, fixed_width} {}
+
+  //! \brief Create an action holding the provided callback
+  //! \tparam Ftor Free function or callback with static storage duration
+  //! \tparam Endianess, Signed_Mode, Integer_Encoding Serialization parameters
+  template<typename F, F Ftor, endianess Endianess, signed_mode Signed_Mode, integer_encoding Integer_Encoding>
+  explicit no_storage_action(unevaluated<F, Ftor>,
+                             endianess_h<Endianess>,
+                             signed_mode_h<Signed_Mode>,
+                             integer_encoding_h<Integer_Encoding>)
+      : m_wrapper{detail::static_storage_duration_callback_wrapper<Endianess, Signed_Mode, Integer_Encoding, F, Ftor>},
+        m_in_place_wrapper{
+            detail::static_storage_duration_in_place_wrapper<Endianess, Signed_Mode, Integer_Encoding, F, Ftor>},
+        m_input_size{detail::encoded_parameters_size<Integer_Encoding, F>::value},
+        m_output_size{detail::encoded_return_type_size<Integer_Encoding, F>::value} {}
 
   //! \copydoc action::operator()()
   template<typename Src, typename Dest, UPD_REQUIREMENT(input_invocable, Src), UPD_REQUIREMENT(output_invocable, Dest)>
   void operator()(Src &&src, Dest &&dest) const {
-    m_wrapper(detail::make_function_reference(src), detail::make_function_reference(dest));
+    m_wrapper(detail::make_byte_source(src), detail::make_byte_sink(dest));
+  }
+
+  //! \copydoc action::call_in_place
+  template<typename Dest, UPD_REQUIREMENT(output_invocable, Dest)>
+  void call_in_place(const byte_t *input, Dest &&dest) const {
+    m_in_place_wrapper(input, detail::make_byte_sink(dest));
   }
 
   //! \copydoc action::input_size
@@ -232,6 +475,7 @@ public:
 
 private:
   void (*m_wrapper)(detail::src_t &&, detail::dest_t &&);
+  void (*m_in_place_wrapper)(const byte_t *, detail::dest_t &&);
   std::size_t m_input_size, m_output_size;
 };
 } // namespace upd
@@ -0,0 +1,179 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+
+#include "detail/type_traits/smallest.hpp"
+
+namespace upd {
+
+//! \brief Sequence of at most `N` elements of type `T`, serialized as its length followed by its elements
+//!
+//! The length of a byte sequence generated by a \ref<key> key is usually fixed by the signature of the associated
+//! callback, so a callback taking "up to 200 bytes of text" would have to take a `char[200]` array and 200 bytes would
+//! always be sent. When a \ref<bounded_vector> bounded_vector instance is passed to a key or returned by an action,
+//! only its length and the elements it actually holds are sent.
+//!
+//! The length is written as the smallest unsigned integer type able to hold `N`, so it usually occupies a single byte.
+//! In a \ref<tuple> tuple, the storage is still as large as needed for the longest sequence, so the maximum length of
+//! packets and the size of the buffers of a \ref<buffered_dispatcher> buffered_dispatcher are known at compile time.
+//!
+//! \code
+//! void log(upd::bounded_vector<upd::byte_t, 200> text);
+//!
+//! // Sends 1 byte of length followed by 3 bytes of content
+//! key(upd::bounded_vector<upd::byte_t, 200>{'a', 'b', 'c'}).write_to(dest);
+//! \endcode
+//!
+//! \tparam T Type of the elements (which must be serializable)
+//! \tparam N Maximum number of elements
+template<typename T, std::size_t N>
+class bounded_vector {
+  static_assert(N > 0, "A bounded vector must be able to hold at least one element");
+
+public:
+  //! \brief Type of the elements
+  using value_type = T;
+
+  //! \brief Type of the length as written before the elements in a byte sequence
+  using length_t = detail::smallest_unsigned_t<N>;
+
+  //! \brief Maximum number of elements
+  constexpr static std::size_t capacity = N;
+
+  //! \brief Initialize an empty sequence
+  bounded_vector() : m_length{0}, m_data{} {}
+
+  //! \brief Initialize the sequence with the provided values
+  //!
+  //! The values which do not fit in the sequence are discarded.
+  bounded_vector(std::initializer_list<T> values) : bounded_vector{} { assign(values.begin(), values.end()); }
+
+  //! \brief Initialize the sequence with the `count` first elements of an array
+  //!
+  //! \copydetails bounded_vector(std::initializer_list<T>)
+  bounded_vector(const T *values, std::size_t count) : bounded_vector{} { assign(values, values + count); }
+
+  //! \brief Replace the content of the sequence with the elements of a range
+  //!
+  //! \copydetails bounded_vector(std::initializer_list<T>)
+  template<typename It>
+  void assign(It first, It last) {
+    m_length = 0;
+    for (; first != last && m_length < N; ++first)
+      m_data[m_length++] = *first;
+  }
+
+  //! \brief Number of elements held by the sequence
+  std::size_t size() const { return m_length; }
+
+  //! \brief Maximum number of elements
+  constexpr static std::size_t max_size() { return N; }
+
+  //! \brief Indicates whether the sequence holds no element
+  bool empty() const { return m_length == 0; }
+
+  //! \brief Indicates whether the sequence holds `N` elements
+  bool full() const { return m_length == N; }
+
+  //! \brief Append an element to the sequence
+  //! \return `false` if the sequence was already full, in which case it is left untouched
+  bool push_back(const T &value) {
+    if (full())
+      return false;
+
+    m_data[m_length++] = value;
+    return true;
+  }
+
+  //! \brief Remove the last element of the sequence
+  //! \warning If the sequence is empty, the behavior is undefined.
+  void pop_back() { m_length--; }
+
+  //! \brief Remove every element of the sequence
+  void clear() { m_length = 0; }
+
+  //! \brief Change the number of elements held by the sequence
+  //!
+  //! The added elements are value-initialized. The length is capped to `N`.
+  void resize(std::size_t count) {
+    count = count < N ? count : N;
+    for (auto i = std::size_t(m_length); i < count; i++)
+      m_data[i] = T{};
+    m_length = length_t(count);
+  }
+
+  //! \brief Access one of the elements
+  //! \warning If `i` is not lesser than size(), the behavior is undefined.
+  T &operator[](std::size_t i) { return m_data[i]; }
+
+  //! \copydoc operator[]
+  const T &operator[](std::size_t i) const { return m_data[i]; }
+
+  //! \brief Pointer to the first element
+  T *data() { return m_data; }
+
+  //! \copydoc data()
+  const T *data() const { return m_data; }
+
+  //! \brief Iterator to the first element
+  T *begin() { return m_data; }
+
+  //! \copydoc begin()
+  const T *begin() const { return m_data; }
+
+  //! \brief Iterator past the last element
+  T *end() { return m_data + m_length; }
+
+  //! \copydoc end()
+  const T *end() const { return m_data + m_length; }
+
+  //! \brief Compare the elements of two sequences
+  friend bool operator==(const bounded_vector &lhs, const bounded_vector &rhs) {
+    if (lhs.size() != rhs.size())
+      return false;
+    for (std::size_t i = 0; i < lhs.size(); i++)
+      if (!(lhs[i] == rhs[i]))
+        return false;
+
+    return true;
+  }
+
+  //! \copydoc operator==
+  friend bool operator!=(const bounded_vector &lhs, const bounded_vector &rhs) { return !(lhs == rhs); }
+
+private:
+  length_t m_length;
+  T m_data[N];
+};
+
+//! \brief String of at most `N` characters, serialized as its length followed by its characters
+//!
+//! \ref<bounded_string> bounded_string instances are \ref<bounded_vector> bounded_vector instances holding `char`
+//! elements, which may also be initialized from null-terminated strings. The null character is not held by the string
+//! and is not serialized.
+//!
+//! \tparam N Maximum number of characters
+template<std::size_t N>
+class bounded_string : public bounded_vector<char, N> {
+  using base_t = bounded_vector<char, N>;
+
+public:
+  using base_t::base_t;
+
+  //! \brief Initialize an empty string
+  bounded_string() = default;
+
+  //! \brief Initialize the string with a null-terminated string
+  //!
+  //! The characters which do not fit in the string are discarded.
+  bounded_string(const char *str) : base_t{str, std::strlen(str)} {}
+
+  //! \brief Number of characters held by the string
+  std::size_t length() const { return base_t::size(); }
+};
+
+} // namespace upd
@@ -2,7 +2,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 
 #include "dispatcher.hpp"
@@ -11,29 +13,36 @@
 #include "unevaluated.hpp"
 #include "upd.hpp"
 
+#include "detail/encoding.hpp"
+#include "detail/io/byte_stream.hpp"
 #include "detail/io/immediate_process.hpp"
 #include "detail/io/immediate_reader.hpp"
 #include "detail/io/immediate_writer.hpp"
 #include "detail/static_error.hpp"
+#include "detail/type_traits/iterator_category.hpp"
 #include "detail/type_traits/require.hpp"
 #include "detail/type_traits/signature.hpp"
 #include "detail/type_traits/typelist.hpp"
 
-// IWYU pragma: no_forward_declare upd::detail::map_parameters_size
+// IWYU pragma: no_forward_declare upd::detail::map_encoded_parameters_size
 
 namespace upd {
 namespace detail {
 
 //! \brief How many bytes that would be needed to represent any action request of `Keyring`
 template<typename Keyring>
-using needed_input_buffer_size =
-    std::integral_constant<std::size_t,
-                           detail::max<detail::map_parameters_size<typename Keyring::signatures_t::type>>::value +
-                               sizeof(typename Keyring::index_t)>;
+using needed_input_buffer_size = std::integral_constant<
+    std::size_t,
+    detail::max<detail::map_encoded_parameters_size<Keyring::integer_encoding,
+                                                    typename Keyring::signatures_t::type>>::value +
+        sizeof(typename Keyring::index_t)>;
 
 //! \brief How many bytes that would be needed to represent any action response of `Keyring`
 template<typename Keyring>
-using needed_output_buffer_size = detail::max<detail::map_parameters_size<typename Keyring::signatures_t::type>>;
+using needed_output_buffer_size = detail::max_p<
+    detail::max<detail::map_encoded_parameters_size<Keyring::integer_encoding, typename Keyring::signatures_t::type>>,
+    detail::max<
+        detail::map_encoded_return_type_size<Keyring::integer_encoding, typename Keyring::signatures_t::type>>>;
 
 } // namespace detail
 
@@ -45,6 +54,27 @@ using needed_output_buffer_size = detail::max<detail::map_parameters_size<typena
 //!
 enum class packet_status { LOADING_PACKET, DROPPED_PACKET, RESOLVED_PACKET };
 
+//! \brief Outcome of putting a chunk of bytes into a buffered dispatcher at once
+struct put_result {
+  //! \brief Number of bytes taken from the chunk
+  std::size_t consumed;
+
+  //! \brief Number of bytes written to the byte putter receiving the responses (if any)
+  std::size_t written;
+
+  //! \brief Number of packets whose action has been called
+  std::size_t resolved_count;
+
+  //! \brief Number of packets dropped because of an invalid index or because they would not fit in the input buffer
+  std::size_t dropped_count;
+
+  //! \brief Status of the last packet the consumed bytes belong to
+  //!
+  //! `packet_status::LOADING_PACKET` means that the chunk ended in the middle of a packet, which will be completed by
+  //! the next bytes to be put.
+  packet_status status;
+};
+
 //! \brief Dispatcher with input / output storage
 //!
 //! Instances of this class may store input and output byte streams while they are received or sent. This allows the
@@ -59,6 +89,11 @@ enum class packet_status { LOADING_PACKET, DROPPED_PACKET, RESOLVED_PACKET };
 //! \note It is possible to use a single buffer as input and output as long as the reading and the writing does
 //! not occur at the same time. For that purpose, is_loaded() will indicate whether the output buffer is empty or not.
 //!
+//! If the keyring uses the `integer_encoding::VARINT` encoding or if some callbacks take bounded sequences (see
+//! \ref<bounded_vector> bounded_vector), the length of an action request depends on its content. The dispatcher then
+//! examines the received bytes to determine how many more are needed, so the caller may still feed it one byte at a
+//! time without knowing where a request ends.
+//!
 //! This class is not self-sufficient and must be derived from according to the CRTP idiom.
 //!
 //! \tparam D Derived class
@@ -102,8 +137,8 @@ public:
   //! \copydoc ImmediateReader_CRTP
   //! \param src Byte getter
   //! \return one of the following :
-  //!   - packet_status::DROPPED_PACKET: The received index was invalid and the input buffer content was therefore
-  //!   discarded.
+  //!   - packet_status::DROPPED_PACKET: The received index was invalid or the packet would not fit in the input
+  //!   buffer, and the input buffer content was therefore discarded.
   //!   - packet_status::RESOLVED_PACKET: The packet was fully loaded and the associated action has been called (the
   //!   input buffer is empty and the output buffer contains the result of the action invocation).
   template<typename Src, UPD_REQUIREMENT(input_invocable, Src)>
@@ -123,40 +158,78 @@ public:
   //! \param byte Byte to put
   //! \return one of the following :
   //!   - packet_status::LOADING_PACKET: The packet is not yet fully loaded.
-  //!   - packet_status::DROPPED_PACKET: The received index was invalid and the input buffer content was therefore
-  //!   discarded.
+  //!   - packet_status::DROPPED_PACKET: The received index was invalid or the packet would not fit in the input
+  //!   buffer, and the input buffer content was therefore discarded.
   //!   - packet_status::RESOLVED_PACKET: The packet was fully loaded and the associated action has been called (the
   //!   input buffer is empty and the output buffer contains the result of the action invocation).
   packet_status put(byte_t byte) {
     derived().ibuf_begin()[m_ibuf_next++] = byte;
+    return --m_load_count > 0 ? packet_status::LOADING_PACKET : advance();
+  }
 
-    if (--m_load_count > 0)
-      return packet_status::LOADING_PACKET;
+  //! \brief Put a chunk of bytes into the input buffer, up to the end of the first packet resolved
+  //!
+  //! The bytes of each packet are copied into the input buffer at once, and packets with an invalid index or which
+  //! would not fit in the input buffer are dropped. As soon as a packet is resolved, the function returns, so that the
+  //! output buffer holding the response may be unloaded before the remaining bytes of the chunk are put.
+  //!
+  //! \param data Beginning of the chunk
+  //! \param size Number of bytes in the chunk
+  //! \return a \ref<put_result> put_result instance whose `consumed` member tells where to resume from
+  put_result put(const byte_t *data, std::size_t size) {
+    put_result result{0, 0, 0, 0, packet_status::LOADING_PACKET};
+    while (result.consumed < size && result.status != packet_status::RESOLVED_PACKET)
+      put_some(data, size, result);
+
+    return result;
+  }
 
-    if (m_is_index_loaded) {
-      call();
-      return packet_status::RESOLVED_PACKET;
-    } else {
-      auto *ibuf_ptr = derived().ibuf_begin();
-      auto index = get_index([&]() { return *ibuf_ptr++; });
-      if (index < m_dispatcher.size) {
-        m_load_count = m_dispatcher[index].input_size();
-        m_is_index_loaded = true;
-
-        if (m_load_count == 0) {
-          call();
-          return packet_status::RESOLVED_PACKET;
-        } else {
-          return packet_status::LOADING_PACKET;
-        }
-      } else {
-        m_load_count = sizeof(index_t);
-        m_ibuf_next = 0;
-        return packet_status::DROPPED_PACKET;
+  //! \brief Put a chunk of bytes into the input buffer, resolving every packet it contains
+  //!
+  //! As in `put(const byte_t *, std::size_t)`, the bytes of each packet are copied at once. The response to each
+  //! resolved packet is written to `output` before the next packet is loaded, so that the whole chunk is consumed.
+  //! If the output buffer still holds a response when this function is called, it is written to `output` first.
+  //!
+  //! \param data Beginning of the chunk
+  //! \param size Number of bytes in the chunk
+  //! \param output Byte putter or output byte iterator
+  //! \return a \ref<put_result> put_result instance
+  template<typename Output, UPD_REQUIRE(detail::is_byte_output<Output>::value)>
+  put_result put(const byte_t *data, std::size_t size, Output &&output) {
+    auto &&dest = normalize_output(UPD_FWD(output));
+
+    put_result result{0, m_obuf_bottom - m_obuf_next, 0, 0, packet_status::LOADING_PACKET};
+    write_to(dest);
+    while (result.consumed < size) {
+      put_some(data, size, result);
+      if (result.status == packet_status::RESOLVED_PACKET) {
+        result.written += m_obuf_bottom - m_obuf_next;
+        write_to(dest);
       }
     }
+
+    return result;
+  }
+
+  //! \name
+  //! \brief Put a contiguous range of bytes (such as a `std::vector` or `std::span` instance) into the input buffer
+  //!
+  //! These functions behave as `put(const byte_t *, std::size_t)` and `put(const byte_t *, std::size_t, Output &&)`.
+  //! @{
+
+  template<typename Range, UPD_REQUIRE(detail::is_contiguous_byte_range<const Range>::value)>
+  put_result put(const Range &range) {
+    return put(detail::range_data(range), detail::range_size(range));
+  }
+  template<typename Range,
+           typename Output,
+           UPD_REQUIRE(detail::is_contiguous_byte_range<const Range>::value && detail::is_byte_output<Output>::value)>
+  put_result put(const Range &range, Output &&output) {
+    return put(detail::range_data(range), detail::range_size(range), UPD_FWD(output));
   }
 
+  //! @}
+
   using detail::immediate_writer<this_t>::write_to;
 
   //! \brief Completely output the output buffer content
@@ -164,8 +237,8 @@ public:
   //! \param dest Byte putter
   template<typename Dest, UPD_REQUIREMENT(output_invocable, Dest)>
   void write_to(Dest &&dest) {
-    while (is_loaded())
-      dest(get());
+    detail::write_bytes(dest, derived().obuf_begin() + m_obuf_next, m_obuf_bottom - m_obuf_next);
+    m_obuf_next = m_obuf_bottom;
   }
 
   UPD_SFINAE_FAILURE_MEMBER(write_all, UPD_ERROR_NOT_OUTPUT(dest))
@@ -255,22 +328,171 @@ public:
   const action_t &operator[](index_t index) const { return m_dispatcher[index]; }
 
 private:
+  //! \brief Update the state of the dispatcher once the requested bytes have been received
+  //! \return the status of the packet being loaded
+  packet_status advance() {
+    if (m_is_index_loaded) {
+      m_load_count = missing_byte_count(has_variable_length_requests_t{});
+    } else {
+      auto index = loaded_index();
+      if (!(index < m_dispatcher.size))
+        return drop();
+
+      m_load_count = loaded_request_length(index);
+      m_is_index_loaded = true;
+    }
+
+    if (m_ibuf_next + m_load_count > detail::needed_input_buffer_size<keyring_t>::value)
+      return drop();
+    if (m_load_count > 0)
+      return packet_status::LOADING_PACKET;
+
+    call();
+    return packet_status::RESOLVED_PACKET;
+  }
+
+  //! \brief Discard the packet being loaded
+  //!
+  //! This happens when its index is invalid or when it does not fit in the input buffer (which may only happen with
+  //! actions whose requests are longer than the ones of the keyring, such as the ones made by `make_delta_action`).
+  //!
+  //! \return `packet_status::DROPPED_PACKET`
+  packet_status drop() {
+    m_is_index_loaded = false;
+    m_load_count = sizeof(index_t);
+    m_ibuf_next = 0;
+    return packet_status::DROPPED_PACKET;
+  }
+
+  //! \brief Copy the bytes of a chunk which the packet being loaded still needs into the input buffer at once
+  //!
+  //! `result` is updated according to the status of the packet.
+  void put_some(const byte_t *data, std::size_t size, put_result &result) {
+    if (m_ibuf_next == 0 && call_from_chunk(data, size, result))
+      return;
+
+    auto count = std::min(size - result.consumed, m_load_count);
+    std::copy(data + result.consumed, data + result.consumed + count, derived().ibuf_begin() + m_ibuf_next);
+    result.consumed += count;
+    m_ibuf_next += count;
+    m_load_count -= count;
+
+    result.status = m_load_count > 0 ? packet_status::LOADING_PACKET : advance();
+    if (result.status == packet_status::RESOLVED_PACKET)
+      result.resolved_count++;
+    else if (result.status == packet_status::DROPPED_PACKET)
+      result.dropped_count++;
+  }
+
+  //! \brief Invoke the action requested by a packet straight from a chunk if the chunk holds the whole packet
+  //!
+  //! No packet must be partially loaded. Packets with an invalid index are left to `put_some`.
+  //!
+  //! \return `true` if and only if the action has been invoked
+  bool call_from_chunk(const byte_t *data, std::size_t size, put_result &result) {
+    auto *packet = data + result.consumed;
+    auto available = size - result.consumed;
+    if (available < sizeof(index_t))
+      return false;
+
+    detail::iterator_reader<const byte_t *> src{packet};
+    auto index = get_index(src);
+    if (!(index < m_dispatcher.size))
+      return false;
+
+    auto payload_size = available - sizeof(index_t);
+    auto length = sizeof(index_t) + request_length(index, src.it, payload_size);
+    if (length > available)
+      return false;
+
+    call(index, src.it);
+    result.consumed += length;
+    result.resolved_count++;
+    result.status = packet_status::RESOLVED_PACKET;
+    return true;
+  }
+
+  //! \name
+  //! \brief Make a byte putter out of an output byte iterator, so that it keeps track of its position
+  //! @{
+
+  template<typename Dest, UPD_REQUIREMENT(output_invocable, Dest)>
+  Dest &&normalize_output(Dest &&dest) {
+    return UPD_FWD(dest);
+  }
+  template<typename It, UPD_REQUIREMENT(output_byte_iterator, It)>
+  detail::iterator_writer<It> normalize_output(It it) {
+    return {it};
+  }
+
+  //! @}
+
   //! \brief Provided that the input buffer does contain a full action request, invoke the corresponding action
+  //!
+  //! The action reads its parameters straight from the input buffer.
+  //!
   //! \warning If the input buffer does not contain a valid action request, the behavior is undefined.
   void call() {
-    m_obuf_bottom = 0;
-    m_obuf_next = 0;
-
-    auto *ibuf_ptr = derived().ibuf_begin();
+    const byte_t *ibuf_ptr = derived().ibuf_begin();
     auto index = get_index([&]() { return *ibuf_ptr++; });
-    m_dispatcher[index]([&]() { return *ibuf_ptr++; },
-                        [&](byte_t byte) { derived().obuf_begin()[m_obuf_bottom++] = byte; });
+    call(index, ibuf_ptr);
 
     m_is_index_loaded = false;
     m_load_count = sizeof(index_t);
     m_ibuf_next = 0;
   }
 
+  //! \brief Invoke the action with the provided index on a full payload and write the response to the output buffer
+  void call(index_t index, const byte_t *payload) {
+    detail::iterator_writer<byte_t *> writer{derived().obuf_begin()};
+    m_dispatcher[index].call_in_place(payload, writer);
+    m_obuf_next = 0;
+    m_obuf_bottom = std::size_t(writer.it - derived().obuf_begin());
+  }
+
+  //! \brief Index of the action request in the input buffer
+  //! \warning If the input buffer does not contain the index yet, the behavior is undefined.
+  index_t loaded_index() {
+    auto *ibuf_ptr = derived().ibuf_begin();
+    return get_index([&]() { return *ibuf_ptr++; });
+  }
+
+  //! \brief Indicates whether the length of some action requests depends on their content
+  using has_variable_length_requests_t =
+      detail::has_variable_length_action_requests<keyring_t::integer_encoding,
+                                                  typename keyring_t::signatures_t::type,
+                                                  action_t>;
+
+  //! \brief Length of the payload of an action request, given its `size` first bytes
+  //! \copydetails detail::action_request_length
+  std::size_t request_length(index_t index, const byte_t *payload, std::size_t size) {
+    return detail::action_request_length<keyring_t::integer_encoding,
+                                         keyring_t::endianess,
+                                         keyring_t::signed_mode,
+                                         typename keyring_t::signatures_t::type>(
+        m_dispatcher[index], index, payload, size);
+  }
+
+  //! \brief Length of the payload of the action request being loaded, given what has been received so far
+  std::size_t loaded_request_length(index_t index) {
+    return request_length(index, derived().ibuf_begin() + sizeof(index_t), m_ibuf_next - sizeof(index_t));
+  }
+
+  //! \name
+  //! \brief Number of bytes to receive before the action request being loaded is complete
+  //!
+  //! Must only be called once the previously requested bytes have been received. If the length of every action request
+  //! is fixed, it is known as soon as the index is loaded.
+  //! @{
+
+  std::size_t missing_byte_count(std::false_type) { return 0; }
+  std::size_t missing_byte_count(std::true_type) {
+    auto length = loaded_request_length(loaded_index()) + sizeof(index_t);
+    return length > m_ibuf_next ? length - m_ibuf_next : 0;
+  }
+
+  //! @}
+
   //! \copydoc dispatcher::get_index
   template<typename Src>
   index_t get_index(Src &&fetch_byte) const {
@@ -0,0 +1,348 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+
+#include "action.hpp"
+#include "format.hpp"
+#include "key.hpp"
+#include "tuple.hpp"
+#include "type.hpp"
+#include "upd.hpp"
+
+#include "detail/encoding.hpp"
+#include "detail/io/byte_stream.hpp"
+#include "detail/io/immediate_writer.hpp"
+#include "detail/type_traits/flatten_tuple.hpp"
+#include "detail/type_traits/index_sequence.hpp"
+#include "detail/type_traits/input_tuple.hpp"
+#include "detail/type_traits/remove_cv_ref.hpp"
+#include "detail/type_traits/require.hpp"
+#include "detail/type_traits/signature.hpp"
+
+namespace upd {
+namespace detail {
+
+//! \brief Size in bytes of the header of a delta-encoded payload holding `N` fields
+//!
+//! The header is a bitmap holding one bit per field, set if the field is part of the payload. The bit of the `I`-th
+//! field is the bit of weight `I % 8` in the `I / 8`-th byte.
+template<std::size_t N>
+struct delta_header_size : std::integral_constant<std::size_t, (N + 7) / 8> {};
+
+//! \brief Set the bits of the header for every field whose representation differs between two tuple storages
+template<typename... Ts, std::size_t... Is>
+void diff_fields(const byte_t *current, const byte_t *last, byte_t *header, index_sequence<Is...>) {
+  std::size_t offset = 0;
+
+  using discard = int[];
+  (void)discard{0,
+                (header[Is / 8] |= byte_t((memcmp(current + offset, last + offset, serialization_size<Ts>::value) != 0)
+                                          << (Is % 8)),
+                 offset += serialization_size<Ts>::value,
+                 0)...};
+}
+
+//! \brief Write the fields of a tuple whose bit is set in the header, in the requested encoding
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename... Ts,
+         typename Dest,
+         std::size_t... Is>
+void write_delta_fields(const tuple<Endianess, Signed_Mode, Ts...> &input,
+                        const byte_t *header,
+                        Dest &dest,
+                        index_sequence<Is...>) {
+  const byte_t *fixed = input.begin();
+
+  using discard = int[];
+  (void)discard{0,
+                (fixed = (header[Is / 8] >> (Is % 8)) & 1
+                             ? write_field<Integer_Encoding, Endianess, Signed_Mode, Ts>(fixed, dest)
+                             : fixed + serialization_size<Ts>::value,
+                 0)...};
+}
+
+//! \brief Read the fields of a tuple whose bit is set in the header, in the requested encoding
+//!
+//! The other fields are left untouched.
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename... Ts,
+         typename Src,
+         std::size_t... Is>
+void read_delta_fields(tuple<Endianess, Signed_Mode, Ts...> &output,
+                       const byte_t *header,
+                       Src &src,
+                       index_sequence<Is...>) {
+  byte_t *fixed = output.begin();
+
+  using discard = int[];
+  (void)discard{0,
+                (fixed = (header[Is / 8] >> (Is % 8)) & 1
+                             ? read_field<Integer_Encoding, Endianess, Signed_Mode, Ts>(fixed, src)
+                             : fixed + serialization_size<Ts>::value,
+                 0)...};
+}
+
+//! \brief Length of a delta-encoded payload holding instances of `Ts...` in the requested encoding
+//!
+//! Only the `size` first bytes of the payload are examined. If they do not contain the whole payload, the returned
+//! length is the smallest one which is consistent with them, so it is never greater than the actual length.
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename... Ts,
+         std::size_t... Is>
+std::size_t delta_fields_length(const tuple<Endianess, Signed_Mode, Ts...> &,
+                                const byte_t *payload,
+                                std::size_t size,
+                                index_sequence<Is...>) {
+  constexpr auto header_size = delta_header_size<sizeof...(Ts)>::value;
+  if (size < header_size)
+    return header_size;
+
+  std::size_t offset = header_size;
+
+  using discard = int[];
+  (void)discard{0,
+                (offset = (payload[Is / 8] >> (Is % 8)) & 1
+                              ? skip_field<Integer_Encoding, Endianess, Signed_Mode, Ts>(payload, size, offset)
+                              : offset,
+                 0)...};
+
+  return offset;
+}
+
+//! \brief Packet holding the arguments which changed since the previous packet generated by a \ref<delta_encoder>
+//! delta_encoder instance
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         typename Index_T,
+         typename... Ts>
+struct delta_message
+    : detail::immediate_writer<delta_message<Endianess, Signed_Mode, Integer_Encoding, Index_T, Ts...>> {
+  using this_t = delta_message<Endianess, Signed_Mode, Integer_Encoding, Index_T, Ts...>;
+
+  //! \brief Store the payload with an empty header
+  delta_message(const Index_T &index_value, const Ts &...values)
+      : index{index_value}, header{}, content{values...} {}
+
+  using detail::immediate_writer<this_t>::write_to;
+
+  //! \brief Output the index, the header then every field whose bit is set in the header
+  template<typename Dest_F, UPD_REQUIREMENT(output_invocable, Dest_F)>
+  void write_to(Dest_F &&insert_byte) const {
+    for (auto byte : index)
+      insert_byte(byte);
+    for (auto byte : header)
+      insert_byte(byte);
+    write_delta_fields<Integer_Encoding>(content, header, insert_byte, make_index_sequence<sizeof...(Ts)>{});
+  }
+
+  tuple<Endianess, Signed_Mode, Index_T> index;
+  byte_t header[delta_header_size<sizeof...(Ts)>::value];
+  tuple<Endianess, Signed_Mode, Ts...> content;
+};
+
+//! \name
+//! \brief Invoke `ftor` on the content of a tuple and write the serialized return value to `dest`
+//! @{
+
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         typename Tuple,
+         typename F,
+         UPD_REQUIREMENT(is_void, detail::return_t<F>)>
+void invoke_into(Tuple &args, dest_t &, F &&ftor) {
+  args.invoke(UPD_FWD(ftor));
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         typename Tuple,
+         typename F,
+         UPD_REQUIREMENT(not_void, detail::return_t<F>)>
+void invoke_into(Tuple &args, dest_t &dest, F &&ftor) {
+  insert<Endianess, Signed_Mode, Integer_Encoding>(dest, args.invoke(UPD_FWD(ftor)));
+}
+
+//! @}
+
+//! \brief Implementation of the actions made by `make_delta_action`
+//!
+//! The arguments of the last call are kept, so that the fields missing from a delta-encoded payload are taken from it.
+template<typename F, endianess Endianess, signed_mode Signed_Mode, integer_encoding Integer_Encoding>
+class delta_action_model : public action_concept {
+  using tuple_t = input_tuple<Endianess, Signed_Mode, F>;
+  using output_tuple_t = flatten_tuple_t<Endianess, Signed_Mode, remove_cv_ref_t<return_t<F>>>;
+  constexpr static auto header_size = delta_header_size<std::tuple_size<tuple_t>::value>::value;
+
+public:
+  explicit delta_action_model(F &&ftor) : m_ftor{UPD_FWD(ftor)} {
+    delta_action_model::input_size = header_size + encoded_tuple_size<Integer_Encoding, tuple_t>::value;
+    delta_action_model::output_size = encoded_tuple_size<Integer_Encoding, output_tuple_t>::value;
+  }
+
+  void operator()(src_t &&src, dest_t &&dest) final {
+    byte_t header[header_size];
+    src.read(header, header_size);
+
+    read_delta_fields<Integer_Encoding>(m_last, header, src, make_index_sequence<std::tuple_size<tuple_t>::value>{});
+    invoke_into<Endianess, Signed_Mode, Integer_Encoding>(m_last, dest, m_ftor);
+  }
+
+  void operator()(const byte_t *input, dest_t &&dest) final {
+    iterator_reader<const byte_t *> reader{input};
+    (*this)(make_byte_source(reader), static_cast<dest_t &&>(dest));
+  }
+
+  std::size_t request_length(const byte_t *payload, std::size_t size) const final {
+    return delta_fields_length<Integer_Encoding>(
+        m_last, payload, size, make_index_sequence<std::tuple_size<tuple_t>::value>{});
+  }
+
+private:
+  F m_ftor;
+  tuple_t m_last;
+};
+
+} // namespace detail
+
+template<typename Key>
+class delta_encoder;
+
+//! \brief Packet generator sending only the arguments which changed since the previous packet
+//!
+//! High-rate telemetry often calls the same action with nearly identical arguments. A \ref<delta_encoder>
+//! delta_encoder instance keeps the arguments of the last packet it generated and only sends the ones which changed,
+//! preceded by a bitmap telling which ones were sent. The callee must handle these packets with an action made by
+//! `make_delta_action`, which keeps its own copy of the arguments.
+//!
+//! Every `keyframe_period` packets, every argument is sent (such a packet is called a keyframe), so that the callee
+//! resynchronizes if it lost a packet or was restarted. The first packet is always a keyframe.
+//!
+//! \code
+//! // Caller
+//! auto encoder = upd::make_delta_encoder(keyring.get(UPD_CTREF(report)), 100);
+//! encoder(x, y, status).write_to(dest);
+//!
+//! // Callee
+//! dispatcher[index] = upd::make_delta_action(report, upd::little_endian, upd::twos_complement);
+//! \endcode
+//!
+//! \warning The packets are framed from their header, so dispatchers handle them like any other request. However, a
+//! keyframe is `header_size` bytes longer than a regular request: a \ref<buffered_dispatcher> buffered_dispatcher
+//! instance drops the keyframes which do not fit in its input buffer, unless another action of its keyring takes a
+//! longer request.
+//!
+//! \tparam Key Template instance of \ref<key> key whose packets are delta-encoded
+#if defined(DOXYGEN)
+template<typename Key>
+class delta_encoder
+#else  // defined(DOXYGEN)
+template<typename Index_T,
+         Index_T Index,
+         typename R,
+         typename... Args,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding>
+class delta_encoder<key<Index_T, Index, R(Args...), Endianess, Signed_Mode, Integer_Encoding>>
+#endif // defined(DOXYGEN)
+{
+  using key_t = key<Index_T, Index, R(Args...), Endianess, Signed_Mode, Integer_Encoding>;
+  using tuple_t = typename key_t::tuple_t;
+  using message_t =
+      detail::delta_message<Endianess, Signed_Mode, Integer_Encoding, Index_T, detail::remove_cv_ref_t<Args>...>;
+
+public:
+  //! \brief Size in bytes of the bitmap preceding the arguments
+  constexpr static auto header_size = detail::delta_header_size<sizeof...(Args)>::value;
+
+  //! \brief Length in bytes of the longest packet (i.e. a keyframe)
+  constexpr static auto payload_length = key_t::payload_length + header_size;
+
+  //! \brief Make an encoder for the packets of the given key
+  //! \param keyframe_period Number of packets between two keyframes (if zero, only the first packet is a keyframe)
+  explicit delta_encoder(key_t, std::size_t keyframe_period)
+      : m_keyframe_period{keyframe_period}, m_countdown{0} {}
+
+  //! \brief Generate a packet holding the arguments which changed since the previous one
+  //!
+  //! The returned object is written like the one returned by \ref<key> key instances: `encoder(x1, x2,
+  //! ...).write_to(dest)`. The arguments are considered sent as soon as this function returns.
+  //!
+  //! \param args... Values to insert in the payload
+  //! \return a temporary object allowing the syntax mentioned above
+  message_t operator()(const Args &...args) {
+    message_t retval{Index, args...};
+
+    if (m_countdown == 0) {
+      for (std::size_t i = 0; i < sizeof...(Args); i++)
+        retval.header[i / 8] |= byte_t(1 << (i % 8));
+      m_countdown = m_keyframe_period;
+    } else {
+      detail::diff_fields<detail::remove_cv_ref_t<Args>...>(
+          retval.content.begin(), m_last.begin(), retval.header, detail::make_index_sequence<sizeof...(Args)>{});
+    }
+
+    m_countdown--;
+    m_last = retval.content;
+    return retval;
+  }
+
+  //! \brief Make the next packet a keyframe
+  //!
+  //! This is useful when the callee is known to have lost track of the arguments (e.g. after it restarted).
+  void request_keyframe() { m_countdown = 0; }
+
+private:
+  tuple_t m_last;
+  std::size_t m_keyframe_period, m_countdown;
+};
+
+//! \brief Make a \ref<delta_encoder> delta_encoder instance
+//! \param k Key whose packets are delta-encoded
+//! \param keyframe_period Number of packets between two keyframes (if zero, only the first packet is a keyframe)
+//! \related delta_encoder
+template<typename Key, UPD_REQUIREMENT(key, Key)>
+delta_encoder<Key> make_delta_encoder(Key k, std::size_t keyframe_period) {
+  return delta_encoder<Key>{k, keyframe_period};
+}
+
+//! \brief Make an action handling the packets generated by a \ref<delta_encoder> delta_encoder instance
+//!
+//! The action keeps the arguments of the last call. When invoked, it only reads the arguments present in the payload
+//! and takes the other ones from that copy.
+//!
+//! \tparam Endianess, Signed_Mode, Integer_Encoding Serialization parameters
+//! \param ftor Callback to be wrapped
+//! \related delta_encoder
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         typename F,
+         UPD_REQUIREMENT(invocable, F)>
+action make_delta_action(F &&ftor,
+                         endianess_h<Endianess>,
+                         signed_mode_h<Signed_Mode>,
+                         integer_encoding_h<Integer_Encoding>) {
+  return detail::action_access::make(std::unique_ptr<detail::action_concept>{
+      new detail::delta_action_model<F, Endianess, Signed_Mode, Integer_Encoding>{UPD_FWD(ftor)}});
+}
+
+//! \copydoc make_delta_action
+template<endianess Endianess, signed_mode Signed_Mode, typename F, UPD_REQUIREMENT(invocable, F)>
+action make_delta_action(F &&ftor, endianess_h<Endianess>, signed_mode_h<Signed_Mode>) {
+  return make_delta_action(UPD_FWD(ftor), endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, fixed_width);
+}
+
+} // namespace upd
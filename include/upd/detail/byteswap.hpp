@@ -0,0 +1,143 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include "../type.hpp"
+#include "type_traits/require.hpp"
+
+#if defined(__AVX2__) || defined(__SSSE3__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif // defined(__AVX2__) || defined(__SSSE3__) || defined(__SSE2__)
+
+namespace upd {
+namespace detail {
+
+//! \name
+//! \brief Reverse the byte order of an unsigned integer
+//! @{
+
+template<typename T, require<sizeof(T) == 1> = 0>
+T byteswap(T x) {
+  return x;
+}
+#if defined(__GNUC__)
+template<typename T, require<sizeof(T) == 2> = 0>
+T byteswap(T x) {
+  return T(__builtin_bswap16(x));
+}
+template<typename T, require<sizeof(T) == 4> = 0>
+T byteswap(T x) {
+  return T(__builtin_bswap32(x));
+}
+template<typename T, require<sizeof(T) == 8> = 0>
+T byteswap(T x) {
+  return T(__builtin_bswap64(x));
+}
+template<typename T, require<sizeof(T) != 1 && sizeof(T) != 2 && sizeof(T) != 4 && sizeof(T) != 8> = 0>
+#else  // defined(__GNUC__)
+template<typename T, require<sizeof(T) != 1> = 0>
+#endif // defined(__GNUC__)
+T byteswap(T x) {
+  auto retval = T(0);
+  for (std::size_t i = 0; i < sizeof x; i++, x = T(x >> 8))
+    retval = T(retval << 8 | (x & 0xff));
+  return retval;
+}
+
+//! @}
+
+//! \brief Shuffle mask which reverses the byte order of every `Size`-byte word in a 16-byte lane
+template<std::size_t Size>
+struct byteswap_mask {
+  constexpr static char at(std::size_t i) { return static_cast<char>(i / Size * Size + Size - 1 - i % Size); }
+};
+
+#if defined(__SSE2__) && !defined(__SSSE3__)
+//! \name
+//! \brief Reverse the byte order of every `Size`-byte word in a 16-byte vector with SSE2 instructions
+//! @{
+
+template<std::size_t Size, require<Size == 2> = 0>
+__m128i byteswap_sse2(__m128i x) {
+  return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+template<std::size_t Size, require<Size == 4> = 0>
+__m128i byteswap_sse2(__m128i x) {
+  x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+  return byteswap_sse2<2>(x);
+}
+template<std::size_t Size, require<Size == 8> = 0>
+__m128i byteswap_sse2(__m128i x) {
+  return byteswap_sse2<4>(_mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+//! @}
+#endif // defined(__SSE2__) && !defined(__SSSE3__)
+
+//! \name
+//! \brief Copy `count` consecutive unsigned integers of type `T` from a byte sequence to another while reversing their
+//! byte order
+//!
+//! The integers do not need to be aligned and both sequences may be the same, but they must not partially overlap. If
+//! the target supports AVX2, SSSE3 or SSE2, 32 or 16 bytes are processed at once. The remaining integers are processed
+//! one by one.
+//! @{
+
+template<typename T, require<sizeof(T) == 1> = 0>
+void byteswap_copy_n(byte_t *dest, const byte_t *src, std::size_t count) {
+  if (dest != src)
+    memcpy(dest, src, count);
+}
+template<typename T, require<sizeof(T) != 1 && 16 % sizeof(T) == 0> = 0>
+void byteswap_copy_n(byte_t *dest, const byte_t *src, std::size_t count) {
+  auto *const end = src + count * sizeof(T);
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+  using mask_t = byteswap_mask<sizeof(T)>;
+#endif // defined(__AVX2__) || defined(__SSSE3__)
+
+#if defined(__AVX2__)
+  const auto mask256 = _mm256_setr_epi8(mask_t::at(0), mask_t::at(1), mask_t::at(2), mask_t::at(3), mask_t::at(4),
+                                        mask_t::at(5), mask_t::at(6), mask_t::at(7), mask_t::at(8), mask_t::at(9),
+                                        mask_t::at(10), mask_t::at(11), mask_t::at(12), mask_t::at(13), mask_t::at(14),
+                                        mask_t::at(15), mask_t::at(0), mask_t::at(1), mask_t::at(2), mask_t::at(3),
+                                        mask_t::at(4), mask_t::at(5), mask_t::at(6), mask_t::at(7), mask_t::at(8),
+                                        mask_t::at(9), mask_t::at(10), mask_t::at(11), mask_t::at(12), mask_t::at(13),
+                                        mask_t::at(14), mask_t::at(15));
+  for (; end - src >= 32; src += 32, dest += 32) {
+    auto word = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest), _mm256_shuffle_epi8(word, mask256));
+  }
+#endif // defined(__AVX2__)
+
+#if defined(__SSSE3__)
+  const auto mask128 = _mm_setr_epi8(mask_t::at(0), mask_t::at(1), mask_t::at(2), mask_t::at(3), mask_t::at(4),
+                                     mask_t::at(5), mask_t::at(6), mask_t::at(7), mask_t::at(8), mask_t::at(9),
+                                     mask_t::at(10), mask_t::at(11), mask_t::at(12), mask_t::at(13), mask_t::at(14),
+                                     mask_t::at(15));
+  for (; end - src >= 16; src += 16, dest += 16) {
+    auto word = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_shuffle_epi8(word, mask128));
+  }
+#elif defined(__SSE2__)
+  for (; end - src >= 16; src += 16, dest += 16) {
+    auto word = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), byteswap_sse2<sizeof(T)>(word));
+  }
+#endif // defined(__SSSE3__)
+
+  for (; src != end; src += sizeof(T), dest += sizeof(T)) {
+    T word;
+    memcpy(&word, src, sizeof word);
+    word = byteswap(word);
+    memcpy(dest, &word, sizeof word);
+  }
+}
+
+//! @}
+
+} // namespace detail
+} // namespace upd
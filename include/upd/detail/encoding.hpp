@@ -0,0 +1,542 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "../format.hpp"
+#include "../tuple.hpp"
+#include "../type.hpp"
+#include "io/byte_stream.hpp"
+#include "serialization.hpp"
+#include "type_traits/conjunction.hpp"
+#include "type_traits/detector.hpp"
+#include "type_traits/flatten_tuple.hpp"
+#include "type_traits/remove_cv_ref.hpp"
+#include "type_traits/require.hpp"
+#include "type_traits/signature.hpp"
+#include "type_traits/typelist.hpp"
+#include "varint.hpp"
+
+namespace upd {
+namespace detail {
+
+//! \brief Check if fields of type `T` are written as varints in the requested encoding
+template<integer_encoding Integer_Encoding, typename T>
+struct is_varint_field
+    : std::integral_constant<bool,
+                             Integer_Encoding == integer_encoding::VARINT &&
+                                 is_varint_integer<typename varint_field<T>::element_t>::value> {};
+
+//! \brief Check if the length of the encoding of instances of `Ts...` may depend on their values
+//!
+//! This is the case with the `integer_encoding::VARINT` encoding or if one of the types is a bounded sequence.
+template<integer_encoding Integer_Encoding, typename... Ts>
+struct is_variable_length
+    : std::integral_constant<bool,
+                             Integer_Encoding == integer_encoding::VARINT ||
+                                 !conjunction<std::integral_constant<bool, !is_bounded<Ts>::value>...>::value> {};
+
+//! \brief Check if the length of the encoding of the content of a tuple may depend on its value
+template<integer_encoding Integer_Encoding, typename Tuple>
+struct is_variable_length_tuple;
+template<integer_encoding Integer_Encoding, endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+struct is_variable_length_tuple<Integer_Encoding, tuple<Endianess, Signed_Mode, Ts...>>
+    : is_variable_length<Integer_Encoding, Ts...> {};
+
+//! \name
+//! \brief Check if the length of an action request for a callback of type `F` may depend on its content
+//! @{
+
+template<integer_encoding Integer_Encoding, typename F>
+struct is_variable_length_request : is_variable_length_request<Integer_Encoding, signature_t<F>> {};
+template<integer_encoding Integer_Encoding, typename R, typename... Args>
+struct is_variable_length_request<Integer_Encoding, R(Args...)>
+    : is_variable_length<Integer_Encoding, remove_cv_ref_t<Args>...> {};
+
+//! @}
+
+//! \brief Check if the length of some action requests for the callbacks in a typelist may depend on their content
+template<integer_encoding Integer_Encoding, typename>
+struct has_variable_length_requests;
+template<integer_encoding Integer_Encoding, typename... Fs>
+struct has_variable_length_requests<Integer_Encoding, tlist_t<Fs...>>
+    : std::integral_constant<bool,
+                             !conjunction<std::integral_constant<
+                                 bool,
+                                 !is_variable_length_request<Integer_Encoding, Fs>::value>...>::value> {};
+
+//! \name
+//! \brief Maximum number of bytes occupied by a field of type `T` when encoded as requested
+//! @{
+
+template<integer_encoding Integer_Encoding, typename T, typename = void>
+struct encoded_size : std::integral_constant<std::size_t, serialization_size<T>::value> {};
+template<typename T>
+struct encoded_size<integer_encoding::VARINT,
+                    T,
+                    require<is_varint_integer<typename varint_field<T>::element_t>::value, void>>
+    : std::integral_constant<std::size_t,
+                             varint_field<T>::value * varint_max_size<typename varint_field<T>::element_t>::value> {};
+template<integer_encoding Integer_Encoding, typename T>
+struct encoded_size<Integer_Encoding, T, require<is_bounded<T>::value, void>>
+    : std::integral_constant<std::size_t,
+                             encoded_size<Integer_Encoding, typename T::length_t>::value +
+                                 T::capacity * encoded_size<Integer_Encoding, typename T::value_type>::value> {};
+
+//! @}
+
+//! \brief Maximum number of bytes occupied by the content of a tuple when encoded as requested
+template<integer_encoding Integer_Encoding, typename Tuple>
+struct encoded_tuple_size;
+template<integer_encoding Integer_Encoding, endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+struct encoded_tuple_size<Integer_Encoding, tuple<Endianess, Signed_Mode, Ts...>>
+    : sum<tlist_t<encoded_size<Integer_Encoding, Ts>...>> {};
+
+//! \name
+//! \brief Maximum number of bytes occupied by the parameters of `F` when encoded as requested
+//! @{
+
+template<integer_encoding Integer_Encoding, typename F>
+struct encoded_parameters_size : encoded_parameters_size<Integer_Encoding, signature_t<F>> {};
+template<integer_encoding Integer_Encoding, typename R, typename... Args>
+struct encoded_parameters_size<Integer_Encoding, R(Args...)>
+    : sum<tlist_t<encoded_size<Integer_Encoding, remove_cv_ref_t<Args>>...>> {};
+
+//! @}
+
+//! \name
+//! \brief Maximum number of bytes occupied by the return value of `F` when encoded as requested
+//! @{
+
+template<integer_encoding Integer_Encoding, typename F>
+struct encoded_return_type_size : encoded_return_type_size<Integer_Encoding, signature_t<F>> {};
+template<integer_encoding Integer_Encoding, typename R, typename... Args>
+struct encoded_return_type_size<Integer_Encoding, R(Args...)>
+    : encoded_tuple_size<Integer_Encoding,
+                         flatten_tuple_t<endianess::LITTLE, signed_mode::TWOS_COMPLEMENT, remove_cv_ref_t<R>>> {};
+
+//! @}
+
+//! \name
+//! \brief Map `encoded_parameters_size` and `encoded_return_type_size` over a typelist of invocable types
+//! @{
+
+template<integer_encoding, typename>
+struct map_encoded_parameters_size;
+template<integer_encoding Integer_Encoding, typename... Fs>
+struct map_encoded_parameters_size<Integer_Encoding, tlist_t<Fs...>>
+    : tlist_t<encoded_parameters_size<Integer_Encoding, Fs>...> {};
+
+template<integer_encoding, typename>
+struct map_encoded_return_type_size;
+template<integer_encoding Integer_Encoding, typename... Fs>
+struct map_encoded_return_type_size<Integer_Encoding, tlist_t<Fs...>>
+    : tlist_t<encoded_return_type_size<Integer_Encoding, Fs>...> {};
+
+//! @}
+
+//! \brief Number of elements of the bounded sequence of type `T` laid out in a tuple storage, capped to its capacity
+template<endianess Endianess, signed_mode Signed_Mode, typename T>
+UPD_CONSTEXPR17 std::size_t bounded_length(const byte_t *fixed) {
+  auto length = std::size_t(read_as<typename T::length_t, Endianess, Signed_Mode>(fixed));
+  return length < T::capacity ? length : T::capacity;
+}
+
+//! \brief Check if fields of type `T` are written as they are laid out in a tuple storage in the requested encoding
+template<integer_encoding Integer_Encoding, typename T>
+struct is_verbatim_field
+    : std::integral_constant<bool, !is_varint_field<Integer_Encoding, T>::value && !is_bounded<T>::value> {};
+
+//! \name
+//! \brief Write a field laid out in a tuple storage in the requested encoding
+//!
+//! Integers (and arrays of integers) are written as varints in the `integer_encoding::VARINT` encoding, after a zigzag
+//! encoding if they are signed. Bounded sequences are written as their length followed by the elements they hold. The
+//! other fields are written as they are laid out.
+//!
+//! \return the address of the next field in the tuple storage
+//! @{
+
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename Dest,
+         require<is_verbatim_field<Integer_Encoding, T>::value> = 0>
+UPD_CONSTEXPR17 const byte_t *write_field(const byte_t *fixed, Dest &dest) {
+  write_bytes(dest, fixed, serialization_size<T>::value);
+  return fixed + serialization_size<T>::value;
+}
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename Dest,
+         require<is_varint_field<Integer_Encoding, T>::value> = 0>
+UPD_CONSTEXPR17 const byte_t *write_field(const byte_t *fixed, Dest &dest) {
+  using element_t = typename varint_field<T>::element_t;
+  for (std::size_t i = 0; i < varint_field<T>::value; i++, fixed += sizeof(element_t))
+    write_varint(to_zigzag(read_as<element_t, Endianess, Signed_Mode>(fixed)), dest);
+
+  return fixed;
+}
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename Dest,
+         require_bounded<T> = 0>
+UPD_CONSTEXPR17 const byte_t *write_field(const byte_t *fixed, Dest &dest) {
+  using length_t = typename T::length_t;
+
+  auto length = bounded_length<Endianess, Signed_Mode, T>(fixed);
+  byte_t prefix[sizeof(length_t)]{};
+  write_as<Endianess, Signed_Mode>(length_t(length), prefix);
+  write_field<Integer_Encoding, Endianess, Signed_Mode, length_t>(prefix, dest);
+
+  using element_t = typename T::value_type;
+  auto *element = fixed + sizeof(length_t);
+  if (is_verbatim_field<Integer_Encoding, element_t>::value)
+    write_bytes(dest, element, length * serialization_size<element_t>::value);
+  else
+    for (std::size_t i = 0; i < length; i++)
+      element = write_field<Integer_Encoding, Endianess, Signed_Mode, element_t>(element, dest);
+
+  return fixed + serialization_size<T>::value;
+}
+
+//! @}
+
+//! \name
+//! \brief Read a field in the requested encoding and lay it out in a tuple storage
+//!
+//! The unused elements of bounded sequences are zeroed.
+//!
+//! \return the address of the next field in the tuple storage
+//! @{
+
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename Src,
+         require<is_verbatim_field<Integer_Encoding, T>::value> = 0>
+byte_t *read_field(byte_t *fixed, Src &src) {
+  read_bytes(src, fixed, serialization_size<T>::value);
+  return fixed + serialization_size<T>::value;
+}
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename Src,
+         require<is_varint_field<Integer_Encoding, T>::value> = 0>
+byte_t *read_field(byte_t *fixed, Src &src) {
+  using element_t = typename varint_field<T>::element_t;
+  using unsigned_t = typename std::make_unsigned<element_t>::type;
+  for (std::size_t i = 0; i < varint_field<T>::value; i++, fixed += sizeof(element_t))
+    write_as<Endianess, Signed_Mode>(from_zigzag<element_t>(read_varint<unsigned_t>(src)), fixed);
+
+  return fixed;
+}
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename Src,
+         require_bounded<T> = 0>
+byte_t *read_field(byte_t *fixed, Src &src) {
+  using length_t = typename T::length_t;
+
+  read_field<Integer_Encoding, Endianess, Signed_Mode, length_t>(fixed, src);
+  auto length = bounded_length<Endianess, Signed_Mode, T>(fixed);
+  write_as<Endianess, Signed_Mode>(length_t(length), fixed);
+
+  using element_t = typename T::value_type;
+  auto *element = fixed + sizeof(length_t);
+  if (is_verbatim_field<Integer_Encoding, element_t>::value) {
+    read_bytes(src, element, length * serialization_size<element_t>::value);
+    element += length * serialization_size<element_t>::value;
+  } else {
+    for (std::size_t i = 0; i < length; i++)
+      element = read_field<Integer_Encoding, Endianess, Signed_Mode, element_t>(element, src);
+  }
+
+  auto *next = fixed + serialization_size<T>::value;
+  memset(element, 0, std::size_t(next - element));
+  return next;
+}
+
+//! @}
+
+//! \name
+//! \brief Offset of the end of a field in the `size` first bytes of a payload in the requested encoding
+//!
+//! If the field is not complete, the returned offset assumes that the bytes to be received will end it as soon as
+//! possible.
+//! @{
+
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         require<is_verbatim_field<Integer_Encoding, T>::value> = 0>
+std::size_t skip_field(const byte_t *, std::size_t, std::size_t offset) {
+  return offset + serialization_size<T>::value;
+}
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         require<is_varint_field<Integer_Encoding, T>::value> = 0>
+std::size_t skip_field(const byte_t *payload, std::size_t size, std::size_t offset) {
+  using element_t = typename varint_field<T>::element_t;
+  for (std::size_t i = 0; i < varint_field<T>::value; i++)
+    offset = skip_varint<element_t>(payload, size, offset);
+
+  return offset;
+}
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         require_bounded<T> = 0>
+std::size_t skip_field(const byte_t *payload, std::size_t size, std::size_t offset) {
+  using length_t = typename T::length_t;
+
+  auto next = skip_field<Integer_Encoding, Endianess, Signed_Mode, length_t>(payload, size, offset);
+  if (next > size)
+    return next;
+
+  byte_t prefix[sizeof(length_t)];
+  auto fetch_byte = [&]() { return payload[offset++]; };
+  read_field<Integer_Encoding, Endianess, Signed_Mode, length_t>(prefix, fetch_byte);
+
+  auto length = bounded_length<Endianess, Signed_Mode, T>(prefix);
+  for (std::size_t i = 0; i < length; i++)
+    next = skip_field<Integer_Encoding, Endianess, Signed_Mode, typename T::value_type>(payload, size, next);
+
+  return next;
+}
+
+//! @}
+
+//! \name
+//! \brief Serialize the content of a tuple field by field in the requested encoding
+//! @{
+
+template<integer_encoding Integer_Encoding, endianess Endianess, signed_mode Signed_Mode, typename Dest>
+UPD_CONSTEXPR17 void write_each_field(const tuple<Endianess, Signed_Mode> &, Dest &&) {}
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename... Ts,
+         typename Dest>
+UPD_CONSTEXPR17 void write_each_field(const tuple<Endianess, Signed_Mode, T, Ts...> &input, Dest &&dest) {
+  const byte_t *fixed = input.begin();
+
+  using discard = int[];
+  (void)discard{(fixed = write_field<Integer_Encoding, Endianess, Signed_Mode, T>(fixed, dest), 0),
+                (fixed = write_field<Integer_Encoding, Endianess, Signed_Mode, Ts>(fixed, dest), 0)...};
+}
+
+//! @}
+
+//! \name
+//! \brief Unserialize the content of a tuple field by field from a byte sequence in the requested encoding
+//! @{
+
+template<integer_encoding Integer_Encoding, endianess Endianess, signed_mode Signed_Mode, typename Src>
+void read_each_field(tuple<Endianess, Signed_Mode> &, Src &&) {}
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename... Ts,
+         typename Src>
+void read_each_field(tuple<Endianess, Signed_Mode, T, Ts...> &output, Src &&src) {
+  byte_t *fixed = output.begin();
+
+  using discard = int[];
+  (void)discard{(fixed = read_field<Integer_Encoding, Endianess, Signed_Mode, T>(fixed, src), 0),
+                (fixed = read_field<Integer_Encoding, Endianess, Signed_Mode, Ts>(fixed, src), 0)...};
+}
+
+//! @}
+
+//! \name
+//! \brief Serialize the content of a tuple in the requested encoding
+//!
+//! If the length of the encoding does not depend on the content, the tuple storage is written as is.
+//! @{
+
+template<integer_encoding Integer_Encoding,
+         typename Tuple,
+         typename Dest,
+         require<!is_variable_length_tuple<Integer_Encoding, Tuple>::value> = 0>
+UPD_CONSTEXPR17 void write_fields(const Tuple &input, Dest &&dest) {
+  write_bytes(dest, input.begin(), Tuple::size);
+}
+template<integer_encoding Integer_Encoding,
+         typename Tuple,
+         typename Dest,
+         require<is_variable_length_tuple<Integer_Encoding, Tuple>::value> = 0>
+UPD_CONSTEXPR17 void write_fields(const Tuple &input, Dest &&dest) {
+  write_each_field<Integer_Encoding>(input, dest);
+}
+
+//! @}
+
+//! \name
+//! \brief Unserialize the content of a tuple from a byte sequence in the requested encoding
+//!
+//! If the length of the encoding does not depend on the content, the byte sequence is copied as is.
+//! @{
+
+template<integer_encoding Integer_Encoding,
+         typename Tuple,
+         typename Src,
+         require<!is_variable_length_tuple<Integer_Encoding, Tuple>::value> = 0>
+void read_fields(Tuple &output, Src &&src) {
+  read_bytes(src, output.begin(), Tuple::size);
+}
+template<integer_encoding Integer_Encoding,
+         typename Tuple,
+         typename Src,
+         require<is_variable_length_tuple<Integer_Encoding, Tuple>::value> = 0>
+void read_fields(Tuple &output, Src &&src) {
+  read_each_field<Integer_Encoding>(output, src);
+}
+
+//! @}
+
+//! \brief Length of a payload holding instances of `Ts...` in the requested encoding
+//!
+//! Only the `size` first bytes of the payload are examined. If they do not contain the whole payload, the returned
+//! length is the smallest one which is consistent with them, so it is never greater than the actual length.
+template<integer_encoding Integer_Encoding, endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+std::size_t fields_length(const byte_t *payload, std::size_t size) {
+  std::size_t offset = 0;
+
+  using discard = int[];
+  (void)discard{0, (offset = skip_field<Integer_Encoding, Endianess, Signed_Mode, Ts>(payload, size, offset), 0)...};
+
+  return offset;
+}
+
+//! \name
+//! \brief Length of an action request payload for a callback of type `F` in the requested encoding
+//! \copydetails fields_length
+//! @{
+
+template<integer_encoding Integer_Encoding, endianess Endianess, signed_mode Signed_Mode, typename F>
+struct request_length : request_length<Integer_Encoding, Endianess, Signed_Mode, signature_t<F>> {};
+template<integer_encoding Integer_Encoding, endianess Endianess, signed_mode Signed_Mode, typename R, typename... Args>
+struct request_length<Integer_Encoding, Endianess, Signed_Mode, R(Args...)> {
+  static std::size_t get(const byte_t *payload, std::size_t size) {
+    return fields_length<Integer_Encoding, Endianess, Signed_Mode, remove_cv_ref_t<Args>...>(payload, size);
+  }
+};
+
+//! @}
+
+//! \brief Length of an action request payload in the requested encoding, given the index of the callback in a typelist
+//! of signatures
+//! \copydetails fields_length
+template<integer_encoding Integer_Encoding, endianess Endianess, signed_mode Signed_Mode, typename>
+struct request_length_table;
+template<integer_encoding Integer_Encoding, endianess Endianess, signed_mode Signed_Mode, typename... Fs>
+struct request_length_table<Integer_Encoding, Endianess, Signed_Mode, tlist_t<Fs...>> {
+  static std::size_t get(std::size_t index, const byte_t *payload, std::size_t size) {
+    using length_t = std::size_t (*)(const byte_t *, std::size_t);
+    static constexpr length_t lengths[] = {&request_length<Integer_Encoding, Endianess, Signed_Mode, Fs>::get...};
+
+    return lengths[index](payload, size);
+  }
+};
+
+UPD_DETAIL_MAKE_DETECTOR(
+    has_request_length_hook_impl,
+    UPD_PACK(typename Action),
+    UPD_PACK(typename = decltype(std::declval<const Action &>().request_length(std::declval<const byte_t *>(),
+                                                                               std::declval<std::size_t>()))))
+
+//! \brief Check if instances of `Action` compute the length of their requests themselves
+//!
+//! This is the case of \ref<action> action instances, whose implementation may not serialize its arguments as the
+//! keyring does (e.g. the ones made by `make_delta_action`).
+template<typename Action>
+struct has_request_length_hook : decltype(has_request_length_hook_impl<Action>(0)) {};
+
+//! \name
+//! \brief Length of the payload of a request for `action`, given the index of its callback in a typelist of signatures
+//! and the `size` first bytes of the payload
+//!
+//! If the length of the action request depends on its content, the returned length is the smallest one which is
+//! consistent with these bytes. If `action` does not compute that length itself, it is deduced from the signatures.
+//! @{
+
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename Signatures,
+         typename Action,
+         require<has_request_length_hook<Action>::value> = 0>
+std::size_t action_request_length(const Action &action, std::size_t, const byte_t *payload, std::size_t size) {
+  return action.request_length(payload, size);
+}
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename Signatures,
+         typename Action,
+         require<!has_request_length_hook<Action>::value &&
+                 !has_variable_length_requests<Integer_Encoding, Signatures>::value> = 0>
+std::size_t action_request_length(const Action &action, std::size_t, const byte_t *, std::size_t) {
+  return action.input_size();
+}
+template<integer_encoding Integer_Encoding,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename Signatures,
+         typename Action,
+         require<!has_request_length_hook<Action>::value &&
+                 has_variable_length_requests<Integer_Encoding, Signatures>::value> = 0>
+std::size_t action_request_length(const Action &, std::size_t index, const byte_t *payload, std::size_t size) {
+  return request_length_table<Integer_Encoding, Endianess, Signed_Mode, Signatures>::get(index, payload, size);
+}
+
+//! @}
+
+//! \brief Check if the length of the requests for actions of type `Action` may depend on their content
+template<integer_encoding Integer_Encoding, typename Signatures, typename Action>
+struct has_variable_length_action_requests
+    : std::integral_constant<bool,
+                             has_request_length_hook<Action>::value ||
+                                 has_variable_length_requests<Integer_Encoding, Signatures>::value> {};
+
+//! \brief Size of the action requests and responses for the callbacks in a typelist of signatures, given the index of
+//! the callback
+//!
+//! With the `integer_encoding::VARINT` encoding, these are the sizes of the longest possible payloads.
+template<integer_encoding Integer_Encoding, typename>
+struct payload_size_table;
+template<integer_encoding Integer_Encoding, typename... Fs>
+struct payload_size_table<Integer_Encoding, tlist_t<Fs...>> {
+  static std::size_t request(std::size_t index) {
+    static constexpr std::size_t sizes[] = {encoded_parameters_size<Integer_Encoding, Fs>::value...};
+    return sizes[index];
+  }
+
+  static std::size_t response(std::size_t index) {
+    static constexpr std::size_t sizes[] = {encoded_return_type_size<Integer_Encoding, Fs>::value...};
+    return sizes[index];
+  }
+};
+
+} // namespace detail
+} // namespace upd
@@ -8,6 +8,7 @@
 #include "../format.hpp"
 #include "../type.hpp"
 #include "../upd.hpp"
+#include "byteswap.hpp"
 #include "type_traits/require.hpp"
 
 namespace upd {
@@ -15,7 +16,7 @@ namespace detail {
 
 //! \brief Platform-agnostic implementations of `from_endianess`
 template<typename T, endianess Endianess, require<Endianess == endianess::LITTLE> = 0>
-T from_endianess_impl(const byte_t *raw_data, std::size_t n) {
+UPD_CONSTEXPR17 T from_endianess_impl(const byte_t *raw_data, std::size_t n) {
   auto retval = T(0);
   std::size_t shift = 0;
 
@@ -26,7 +27,7 @@ T from_endianess_impl(const byte_t *raw_data, std::size_t n) {
   return retval;
 }
 template<typename T, endianess Endianess, require<Endianess == endianess::BIG> = 0>
-T from_endianess_impl(const byte_t *raw_data, std::size_t n) {
+UPD_CONSTEXPR17 T from_endianess_impl(const byte_t *raw_data, std::size_t n) {
   auto retval = T(0);
   unsigned int shift = 0;
 
@@ -36,40 +37,193 @@ T from_endianess_impl(const byte_t *raw_data, std::size_t n) {
   return retval;
 }
 
+//! \brief Get the endianess opposite to the provided one
+constexpr endianess opposite(endianess value) {
+  return value == endianess::LITTLE ? endianess::BIG : endianess::LITTLE;
+}
+
 //! \brief Interpret a sequence of byte as an integer according to the provided endianess
+//!
+//! If `n` equals `sizeof(T)` and the platform endianess is known, the integer is copied with `memcpy` (and its byte
+//! order is reversed if the platform endianess is not `Endianess`). Otherwise, or if the function is evaluated at
+//! compile time (since C++17), the platform-agnostic implementation is used.
 template<typename T, endianess Endianess, UPD_REQUIRE(platform_info.endianess == Endianess)>
-T from_endianess(const byte_t *raw_data, std::size_t n) {
+UPD_CONSTEXPR17 T from_endianess(const byte_t *raw_data, std::size_t n) {
+  if (n != sizeof(T) || UPD_DETAIL_IS_CONSTANT_EVALUATED())
+    return from_endianess_impl<T, Endianess>(raw_data, n);
+
   auto retval = T(0);
-  memcpy(&retval, raw_data, n);
+  memcpy(&retval, raw_data, sizeof retval);
 
   return retval;
 }
-template<typename T, endianess Endianess, UPD_REQUIRE(platform_info.endianess != Endianess)>
-T from_endianess(const byte_t *raw_data, std::size_t n) {
+template<typename T, endianess Endianess, UPD_REQUIRE(platform_info.endianess == opposite(Endianess))>
+UPD_CONSTEXPR17 T from_endianess(const byte_t *raw_data, std::size_t n) {
+  if (n != sizeof(T) || UPD_DETAIL_IS_CONSTANT_EVALUATED())
+    return from_endianess_impl<T, Endianess>(raw_data, n);
+
+  auto retval = T(0);
+  memcpy(&retval, raw_data, sizeof retval);
+
+  return byteswap(retval);
+}
+template<typename T,
+         endianess Endianess,
+         UPD_REQUIRE(platform_info.endianess != Endianess && platform_info.endianess != opposite(Endianess))>
+UPD_CONSTEXPR17 T from_endianess(const byte_t *raw_data, std::size_t n) {
   return from_endianess_impl<T, Endianess>(raw_data, n);
 }
 
 //! \brief Platform-agnostic implementations of `to_endianess`
 template<endianess Endianess, typename T, require<Endianess == endianess::LITTLE> = 0>
-void to_endianess_impl(byte_t *raw_data, T x, std::size_t n) {
+UPD_CONSTEXPR17 void to_endianess_impl(byte_t *raw_data, T x, std::size_t n) {
   for (std::size_t i = 0; i < n; i++, x = T(x >> 8))
     raw_data[i] = x & 0xff;
 }
 template<endianess Endianess, typename T, require<Endianess == endianess::BIG> = 0>
-void to_endianess_impl(byte_t *raw_data, T x, std::size_t n) {
+UPD_CONSTEXPR17 void to_endianess_impl(byte_t *raw_data, T x, std::size_t n) {
   for (std::size_t i = 0; i < n; i++, x = T(x >> 8))
     raw_data[(n - i - 1)] = x & 0xff;
 }
 
 //! \brief Serialize an integer into a sequence of byte according to the provided endianess
+//!
+//! \copydetails from_endianess
 template<endianess Endianess, typename T, UPD_REQUIRE(platform_info.endianess == Endianess)>
-void to_endianess(byte_t *raw_data, const T &x, std::size_t n) {
-  memcpy(raw_data, &x, n);
+UPD_CONSTEXPR17 void to_endianess(byte_t *raw_data, const T &x, std::size_t n) {
+  if (n != sizeof(T) || UPD_DETAIL_IS_CONSTANT_EVALUATED())
+    return to_endianess_impl<Endianess, T>(raw_data, x, n);
+
+  memcpy(raw_data, &x, sizeof x);
 }
-template<endianess Endianess, typename T, UPD_REQUIRE(platform_info.endianess != Endianess)>
-void to_endianess(byte_t *raw_data, const T &x, std::size_t n) {
+template<endianess Endianess, typename T, UPD_REQUIRE(platform_info.endianess == opposite(Endianess))>
+UPD_CONSTEXPR17 void to_endianess(byte_t *raw_data, const T &x, std::size_t n) {
+  if (n != sizeof(T) || UPD_DETAIL_IS_CONSTANT_EVALUATED())
+    return to_endianess_impl<Endianess, T>(raw_data, x, n);
+
+  auto swapped = byteswap(x);
+  memcpy(raw_data, &swapped, sizeof swapped);
+}
+template<endianess Endianess,
+         typename T,
+         UPD_REQUIRE(platform_info.endianess != Endianess && platform_info.endianess != opposite(Endianess))>
+UPD_CONSTEXPR17 void to_endianess(byte_t *raw_data, const T &x, std::size_t n) {
   to_endianess_impl<Endianess, T>(raw_data, x, n);
 }
 
+//! \brief Interpret a sequence of bytes as `count` consecutive unsigned integers according to the provided endianess
+//!
+//! If the platform endianess is known, the integers are either copied with a single `memcpy` or copied with their byte
+//! order reversed in bulk. Otherwise, the platform-agnostic implementation is used.
+template<typename T,
+         endianess Endianess,
+         UPD_REQUIRE(platform_info.endianess == Endianess || platform_info.endianess == opposite(Endianess))>
+void from_endianess_n(const byte_t *raw_data, T *values, std::size_t count) {
+  if (platform_info.endianess == Endianess)
+    memcpy(values, raw_data, count * sizeof(T));
+  else
+    byteswap_copy_n<T>(reinterpret_cast<byte_t *>(values), raw_data, count);
+}
+template<typename T,
+         endianess Endianess,
+         UPD_REQUIRE(platform_info.endianess != Endianess && platform_info.endianess != opposite(Endianess))>
+void from_endianess_n(const byte_t *raw_data, T *values, std::size_t count) {
+  for (std::size_t i = 0; i < count; i++)
+    values[i] = from_endianess_impl<T, Endianess>(raw_data + i * sizeof(T), sizeof(T));
+}
+
+//! \brief Serialize `count` consecutive unsigned integers into a sequence of bytes according to the provided endianess
+//!
+//! \copydetails from_endianess_n
+template<endianess Endianess,
+         typename T,
+         UPD_REQUIRE(platform_info.endianess == Endianess || platform_info.endianess == opposite(Endianess))>
+void to_endianess_n(byte_t *raw_data, const T *values, std::size_t count) {
+  if (platform_info.endianess == Endianess)
+    memcpy(raw_data, values, count * sizeof(T));
+  else
+    byteswap_copy_n<T>(raw_data, reinterpret_cast<const byte_t *>(values), count);
+}
+template<endianess Endianess,
+         typename T,
+         UPD_REQUIRE(platform_info.endianess != Endianess && platform_info.endianess != opposite(Endianess))>
+void to_endianess_n(byte_t *raw_data, const T *values, std::size_t count) {
+  for (std::size_t i = 0; i < count; i++)
+    to_endianess_impl<Endianess, T>(raw_data + i * sizeof(T), values[i], sizeof(T));
+}
+
+//! \brief Interpret a sequence of bytes as `count` consecutive `n`-byte unsigned integers, held by `T` instances
+//!
+//! If the platform endianess is known, every integer is loaded as a whole `T` with a single `memcpy` (reading the
+//! first bytes of the next integers) and the extra bytes are discarded. Only the last integers, which would be read
+//! past the end of the sequence, are loaded byte by byte.
+template<typename T,
+         endianess Endianess,
+         UPD_REQUIRE(platform_info.endianess == Endianess || platform_info.endianess == opposite(Endianess))>
+void from_endianess_n(const byte_t *raw_data, T *values, std::size_t count, std::size_t n) {
+  auto overlapping_count = (sizeof(T) - 1) / n;
+  auto extra_bits = 8 * (sizeof(T) - n);
+
+  std::size_t i = 0;
+  for (; i + overlapping_count < count; i++) {
+    T word;
+    memcpy(&word, raw_data + i * n, sizeof word);
+    // The extra bytes are the most significant ones in little endian and the least significant ones in big endian
+    values[i] = platform_info.endianess == Endianess ? T(T(word << extra_bits) >> extra_bits)
+                                                      : T(byteswap(word) >> extra_bits);
+  }
+  for (; i < count; i++)
+    values[i] = from_endianess_impl<T, Endianess>(raw_data + i * n, n);
+}
+template<typename T,
+         endianess Endianess,
+         UPD_REQUIRE(platform_info.endianess != Endianess && platform_info.endianess != opposite(Endianess))>
+void from_endianess_n(const byte_t *raw_data, T *values, std::size_t count, std::size_t n) {
+  for (std::size_t i = 0; i < count; i++)
+    values[i] = from_endianess_impl<T, Endianess>(raw_data + i * n, n);
+}
+
+//! \brief Serialize `count` consecutive unsigned integers held by `T` instances as `n`-byte integers
+//!
+//! The integers must be representable in `n` bytes. If the platform endianess is known, every integer is stored as a
+//! whole `T` with a single `memcpy`, and the extra bytes are overwritten when storing the next integers. Only the last
+//! integers, which would be written past the end of the sequence, are stored byte by byte.
+template<endianess Endianess,
+         typename T,
+         UPD_REQUIRE(platform_info.endianess == Endianess || platform_info.endianess == opposite(Endianess))>
+void to_endianess_n(byte_t *raw_data, const T *values, std::size_t count, std::size_t n) {
+  auto overlapping_count = (sizeof(T) - 1) / n;
+  auto extra_bits = 8 * (sizeof(T) - n);
+
+  std::size_t i = 0;
+  for (; i + overlapping_count < count; i++) {
+    auto word = platform_info.endianess == Endianess ? values[i] : byteswap(T(values[i] << extra_bits));
+    memcpy(raw_data + i * n, &word, sizeof word);
+  }
+  for (; i < count; i++)
+    to_endianess_impl<Endianess, T>(raw_data + i * n, values[i], n);
+}
+template<endianess Endianess,
+         typename T,
+         UPD_REQUIRE(platform_info.endianess != Endianess && platform_info.endianess != opposite(Endianess))>
+void to_endianess_n(byte_t *raw_data, const T *values, std::size_t count, std::size_t n) {
+  for (std::size_t i = 0; i < count; i++)
+    to_endianess_impl<Endianess, T>(raw_data + i * n, values[i], n);
+}
+
+//! \brief Copy `n` bytes ordered from the least significant one, reordering them according to the provided endianess
+//!
+//! The bytes are copied as is for little endian and reversed for big endian. Since reversing is its own inverse, this
+//! function also copies bytes ordered according to `Endianess` back from the least significant one.
+template<endianess Endianess, require<Endianess == endianess::LITTLE> = 0>
+void copy_in_endianess(byte_t *dest, const byte_t *src, std::size_t n) {
+  memcpy(dest, src, n);
+}
+template<endianess Endianess, require<Endianess == endianess::BIG> = 0>
+void copy_in_endianess(byte_t *dest, const byte_t *src, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++)
+    dest[i] = src[n - i - 1];
+}
+
 } // namespace detail
 } // namespace upd
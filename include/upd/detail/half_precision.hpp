@@ -0,0 +1,142 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif // defined(__F16C__)
+
+namespace upd {
+namespace detail {
+
+static_assert(std::numeric_limits<float>::is_iec559 && sizeof(float) == 4,
+              "Half-precision conversions require `float` to be represented in the IEEE 754 binary32 format");
+
+//! \name
+//! \brief Get the object representation of a `float` or make a `float` out of it
+//! @{
+
+inline std::uint32_t float_bits(float x) {
+  std::uint32_t retval;
+  memcpy(&retval, &x, sizeof retval);
+  return retval;
+}
+inline float bits_to_float(std::uint32_t bits) {
+  float retval;
+  memcpy(&retval, &bits, sizeof retval);
+  return retval;
+}
+
+//! @}
+
+//! \brief Convert a `float` into an IEEE 754 binary16 value, rounding to the nearest even representable value
+//!
+//! The result is the same as the one of the F16C instructions: values too large are rounded to infinity and NaNs are
+//! quieted, keeping the sign and the upper bits of their payload.
+inline std::uint16_t float_to_float16_bits(float x) {
+  auto bits = float_bits(x);
+  auto sign = std::uint16_t((bits >> 16) & 0x8000);
+  auto abs = bits & 0x7fffffff;
+
+  if (abs > 0x7f800000)
+    return std::uint16_t(sign | 0x7e00 | ((abs >> 13) & 0x3ff));
+  // 65520 is halfway between the largest finite value and the next power of 2, so it is rounded to infinity
+  if (abs >= 0x477ff000)
+    return std::uint16_t(sign | 0x7c00);
+  // Below 2^-25, values are closer to zero than to the smallest subnormal value (2^-25 itself is rounded to even)
+  if (abs <= 0x33000000)
+    return sign;
+
+  std::uint32_t retval, remainder, halfway;
+  if (abs < 0x38800000) {
+    // Subnormal values: the significand (with its implicit bit) is shifted so that its unit is 2^-24
+    auto shift = 126 - (abs >> 23);
+    auto significand = (abs & 0x7fffff) | 0x800000;
+    retval = significand >> shift;
+    remainder = significand & ((std::uint32_t(1) << shift) - 1);
+    halfway = std::uint32_t(1) << (shift - 1);
+  } else {
+    // Normal values: the exponent is rebiased from 127 to 15 and the significand is truncated to 10 bits
+    retval = (abs - 0x38000000) >> 13;
+    remainder = abs & 0x1fff;
+    halfway = 0x1000;
+  }
+
+  if (remainder > halfway || (remainder == halfway && (retval & 1)))
+    retval++;
+  return std::uint16_t(sign | retval);
+}
+
+//! \brief Convert an IEEE 754 binary16 value into a `float`
+//!
+//! The conversion is exact. As with the F16C instructions, signaling NaNs are quieted.
+inline float float16_bits_to_float(std::uint16_t x) {
+  auto sign = std::uint32_t(x & 0x8000) << 16;
+  auto exponent = std::uint32_t(x >> 10) & 0x1f;
+  auto significand = std::uint32_t(x) & 0x3ff;
+
+  if (exponent == 0x1f)
+    return bits_to_float(sign | 0x7f800000 | (significand ? 0x400000 | significand << 13 : 0));
+  if (exponent == 0) {
+    // Zeros and subnormal values are exactly `significand * 2^-24`
+    auto magnitude = float(significand) * (1.f / 16777216.f);
+    return bits_to_float(sign | float_bits(magnitude));
+  }
+
+  return bits_to_float(sign | (exponent + 112) << 23 | significand << 13);
+}
+
+//! \brief Convert a `float` into a bfloat16 value, rounding to the nearest even representable value
+//!
+//! NaNs are quieted, keeping the sign and the upper bits of their payload. This function only selects between integer
+//! values, so that loops calling it can be vectorized.
+inline std::uint16_t float_to_bfloat16_bits(float x) {
+  auto bits = float_bits(x);
+  auto rounded = (bits + 0x7fff + ((bits >> 16) & 1)) >> 16;
+  auto quieted = (bits >> 16) | 0x40;
+
+  return std::uint16_t((bits & 0x7fffffff) > 0x7f800000 ? quieted : rounded);
+}
+
+//! \brief Convert a bfloat16 value into a `float`
+//!
+//! The conversion is exact.
+inline float bfloat16_bits_to_float(std::uint16_t x) { return bits_to_float(std::uint32_t(x) << 16); }
+
+//! \name
+//! \brief Convert `count` values between `float` and the IEEE 754 binary16 format
+//!
+//! When F16C instructions are available, values are converted by 8 and the remaining ones one by one. Both paths give
+//! the same results.
+//! @{
+
+inline void float_to_float16_bits_n(const float *values, std::uint16_t *output, std::size_t count) {
+  std::size_t i = 0;
+#if defined(__F16C__)
+  for (; i < count / 8 * 8; i += 8) {
+    auto converted = _mm256_cvtps_ph(_mm256_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), converted);
+  }
+#endif // defined(__F16C__)
+  for (; i < count; i++)
+    output[i] = float_to_float16_bits(values[i]);
+}
+inline void float16_bits_to_float_n(const std::uint16_t *values, float *output, std::size_t count) {
+  std::size_t i = 0;
+#if defined(__F16C__)
+  for (; i < count / 8 * 8; i += 8)
+    _mm256_storeu_ps(output + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i))));
+#endif // defined(__F16C__)
+  for (; i < count; i++)
+    output[i] = float16_bits_to_float(values[i]);
+}
+
+//! @}
+
+} // namespace detail
+} // namespace upd
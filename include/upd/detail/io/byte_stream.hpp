@@ -0,0 +1,166 @@
+//! \file
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include "../../type.hpp"
+#include "../../upd.hpp"
+#include "../function_reference.hpp"
+#include "../type_traits/has_bulk_io.hpp"
+#include "../type_traits/require.hpp"
+
+namespace upd {
+namespace detail {
+
+//! \name
+//! \brief Read `size` bytes from `src` into `output`
+//!
+//! If `src` is able to read several bytes at once, it is called only once.
+//! @{
+
+template<typename Src, UPD_REQUIRE(has_bulk_read<Src>::value)>
+void read_bytes(Src &src, byte_t *output, std::size_t size) {
+  src.read(output, size);
+}
+template<typename Src, UPD_REQUIRE(!has_bulk_read<Src>::value)>
+void read_bytes(Src &src, byte_t *output, std::size_t size) {
+  for (std::size_t i = 0; i < size; i++)
+    output[i] = src();
+}
+
+//! @}
+
+//! \name
+//! \brief Write the `size` bytes starting at `input` to `dest`
+//!
+//! If `dest` is able to write several bytes at once, it is called only once.
+//! @{
+
+template<typename Dest, UPD_REQUIRE(has_bulk_write<Dest>::value)>
+void write_bytes(Dest &dest, const byte_t *input, std::size_t size) {
+  dest.write(input, size);
+}
+template<typename Dest, UPD_REQUIRE(!has_bulk_write<Dest>::value)>
+UPD_CONSTEXPR17 void write_bytes(Dest &dest, const byte_t *input, std::size_t size) {
+  for (std::size_t i = 0; i < size; i++)
+    dest(input[i]);
+}
+
+//! @}
+
+//! \name
+//! \brief Copy `size` bytes from an input iterator and return the iterator past the last copied byte
+//!
+//! Random access iterators are copied from with `std::copy`, which boils down to `memmove` with pointers and most
+//! contiguous iterators.
+//! @{
+
+template<typename It>
+It copy_from_iterator(It it, byte_t *output, std::size_t size, std::input_iterator_tag) {
+  for (std::size_t i = 0; i < size; i++)
+    output[i] = *it++;
+
+  return it;
+}
+template<typename It>
+It copy_from_iterator(It it, byte_t *output, std::size_t size, std::random_access_iterator_tag) {
+  using difference_t = typename std::iterator_traits<It>::difference_type;
+
+  std::copy(it, it + difference_t(size), output);
+  return it + difference_t(size);
+}
+
+//! @}
+
+//! \brief Byte getter reading from an input iterator
+//!
+//! Unlike a lambda dereferencing the iterator, instances are able to read several bytes at once.
+template<typename It>
+struct iterator_reader {
+  byte_t operator()() { return *it++; }
+
+  void read(byte_t *output, std::size_t size) {
+    it = copy_from_iterator(it, output, size, typename std::iterator_traits<It>::iterator_category{});
+  }
+
+  It it;
+};
+
+//! \brief Byte putter writing to an output iterator
+//!
+//! Unlike a lambda dereferencing the iterator, instances are able to write several bytes at once.
+template<typename It>
+struct iterator_writer {
+  void operator()(byte_t byte) { *it++ = byte; }
+
+  void write(const byte_t *input, std::size_t size) { it = std::copy(input, input + size, it); }
+
+  It it;
+};
+
+//! \brief Byte getter with erased type
+//!
+//! Besides reading bytes one by one, byte getters with erased type are able to read several bytes with a single
+//! virtual call.
+struct byte_source : abstract_function<byte_t()> {
+  virtual void read(byte_t *output, std::size_t size) = 0;
+};
+
+//! \brief Byte putter with erased type
+//!
+//! Besides writing bytes one by one, byte putters with erased type are able to write several bytes with a single
+//! virtual call.
+struct byte_sink : abstract_function<void(byte_t)> {
+  virtual void write(const byte_t *input, std::size_t size) = 0;
+};
+
+//! \brief Wrap a reference to a byte getter and make it available through the `byte_source` interface
+//!
+//! If the byte getter is able to read several bytes at once (such as `iterator_reader` instances), `read` calls are
+//! forwarded to it. Otherwise, it is called on each byte, but without going through a virtual call for each of them.
+template<typename Src>
+class byte_source_reference : public byte_source {
+public:
+  explicit byte_source_reference(Src &src) : m_src{src} {}
+
+  byte_t operator()() final { return m_src(); }
+
+  void read(byte_t *output, std::size_t size) final { read_bytes(m_src, output, size); }
+
+private:
+  Src &m_src;
+};
+
+//! \brief Wrap a reference to a byte putter and make it available through the `byte_sink` interface
+//!
+//! \see byte_source_reference
+template<typename Dest>
+class byte_sink_reference : public byte_sink {
+public:
+  explicit byte_sink_reference(Dest &dest) : m_dest{dest} {}
+
+  void operator()(byte_t byte) final { m_dest(byte); }
+
+  void write(const byte_t *input, std::size_t size) final { write_bytes(m_dest, input, size); }
+
+private:
+  Dest &m_dest;
+};
+
+//! \brief Wrap a byte getter by reference into a `byte_source_reference` object
+template<typename Src>
+byte_source_reference<Src> make_byte_source(Src &src) {
+  return byte_source_reference<Src>{src};
+}
+
+//! \brief Wrap a byte putter by reference into a `byte_sink_reference` object
+template<typename Dest>
+byte_sink_reference<Dest> make_byte_sink(Dest &dest) {
+  return byte_sink_reference<Dest>{dest};
+}
+
+} // namespace detail
+} // namespace upd
@@ -4,6 +4,7 @@
 
 #include "../../type.hpp"
 #include "../../upd.hpp"
+#include "byte_stream.hpp"
 #include "../type_traits/iterator_category.hpp"
 #include "../type_traits/no_derived_member_shadowing.hpp"
 #include "../type_traits/remove_cv_ref.hpp"
@@ -42,20 +43,6 @@ private:
   struct reader_tag_t {};
   struct writer_tag_t {};
 
-  //! \brief Iterator wrapper behaving like an input functor
-  template<typename It>
-  struct reader_iterator {
-    byte_t operator()() { return *it++; }
-    It it;
-  };
-
-  //! \brief Iterator wrapper behaving like an output functor
-  template<typename It>
-  struct writer_iterator {
-    void operator()(byte_t byte) { *it++ = byte; }
-    It it;
-  };
-
   //! Behave as an identity function
   template<typename F>
   F &&normalize(F &&ftor, ...) {
@@ -69,27 +56,30 @@ private:
   }
 
   //! Wrap the iterator to get an input functor
+  //!
+  //! Contiguous byte iterators are replaced with plain pointers when possible (see `unwrap_byte_iterator`). The
+  //! resulting functor is able to read several bytes at once.
   template<typename It, UPD_REQUIREMENT(input_byte_iterator, It)>
-  reader_iterator<It> normalize(It it, reader_tag_t) {
-    return {it};
+  auto normalize(It it, reader_tag_t) -> iterator_reader<decay_t<decltype(unwrap_byte_iterator(it))>> {
+    return {unwrap_byte_iterator(it)};
   }
 
   //! Wrap the iterator to get an input functor
   template<typename It, UPD_REQUIREMENT(input_byte_iterator, It)>
-  reader_iterator<It> normalize(It it, reader_tag_t) const {
-    return {it};
+  auto normalize(It it, reader_tag_t) const -> iterator_reader<decay_t<decltype(unwrap_byte_iterator(it))>> {
+    return {unwrap_byte_iterator(it)};
   }
 
   //! Wrap the iterator to get an output functor
   template<typename It, UPD_REQUIREMENT(output_byte_iterator, It)>
-  writer_iterator<It> normalize(It it, writer_tag_t) {
-    return {it};
+  auto normalize(It it, writer_tag_t) -> iterator_writer<decay_t<decltype(unwrap_byte_iterator(it))>> {
+    return {unwrap_byte_iterator(it)};
   }
 
   //! Wrap the iterator to get an output functor
   template<typename It, UPD_REQUIREMENT(output_byte_iterator, It)>
-  writer_iterator<It> normalize(It it, writer_tag_t) const {
-    return {it};
+  auto normalize(It it, writer_tag_t) const -> iterator_writer<decay_t<decltype(unwrap_byte_iterator(it))>> {
+    return {unwrap_byte_iterator(it)};
   }
 };
 
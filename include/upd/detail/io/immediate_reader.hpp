@@ -3,6 +3,7 @@
 #pragma once
 
 #include "../../upd.hpp"
+#include "byte_stream.hpp"
 #include "../type_traits/require.hpp"
 
 namespace upd {
@@ -30,12 +31,12 @@ public:
 
   template<typename It, UPD_REQUIREMENT(input_byte_iterator, It)>
   R read_from(It it) {
-    return derived().read_from([&]() { return *it++; });
+    return derived().read_from(iterator_reader<It>{it});
   }
 
   template<typename It, UPD_REQUIREMENT(input_byte_iterator, It)>
   R read_from(It it) const {
-    return derived().read_from([&]() { return *it++; });
+    return derived().read_from(iterator_reader<It>{it});
   }
 
   template<typename It, UPD_REQUIREMENT(input_byte_iterator, It)>
@@ -4,6 +4,7 @@
 
 #include "../../type.hpp"
 #include "../../upd.hpp"
+#include "byte_stream.hpp"
 #include "../type_traits/require.hpp"
 
 namespace upd {
@@ -31,12 +32,12 @@ public:
 
   template<typename It, UPD_REQUIREMENT(output_byte_iterator, It)>
   void write_to(It it) {
-    derived().write_to([&](byte_t byte) { *it++ = byte; });
+    derived().write_to(iterator_writer<It>{it});
   }
 
   template<typename It, UPD_REQUIREMENT(output_byte_iterator, It)>
   void write_to(It it) const {
-    derived().write_to([&](byte_t byte) { *it++ = byte; });
+    derived().write_to(iterator_writer<It>{it});
   }
 
   template<typename It, UPD_REQUIREMENT(output_byte_iterator, It)>
@@ -0,0 +1,217 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../typelist.hpp"
+#include "type_traits/index_sequence.hpp"
+#include "type_traits/is_array.hpp"
+#include "type_traits/is_user_serializable.hpp"
+
+namespace upd {
+namespace detail {
+
+//! \brief Maximum number of fields of an aggregate which can be reflected
+constexpr std::size_t max_reflected_field_count = 16;
+
+#if __cplusplus >= 201703L
+
+//! \brief Placeholder convertible to any type, used to initialize the fields of an aggregate
+struct any_field {
+  template<typename T>
+  operator T() const;
+};
+
+//! \brief Placeholder only convertible to the base classes of `T`, used to detect them
+template<typename T>
+struct any_base {
+  template<typename U,
+           typename std::enable_if<std::is_base_of<U, T>::value && !std::is_same<U, T>::value, int>::type = 0>
+  operator U() const;
+};
+
+//! \name
+//! \brief Check if the first initializer of the aggregate `T` can be one of its base classes
+//! @{
+
+template<typename T>
+auto is_brace_constructible_from_base(int) -> decltype(T{any_base<T>{}}, std::true_type{});
+template<typename T>
+std::false_type is_brace_constructible_from_base(...);
+
+//! @}
+
+//! \name
+//! \brief Check if `T` can be aggregate-initialized with as many initializers as there are elements in `Is...`
+//! @{
+
+template<typename T, std::size_t... Is>
+auto is_brace_constructible(index_sequence<Is...>) -> decltype(T{(void(Is), any_field{})...}, std::true_type{});
+template<typename T>
+std::false_type is_brace_constructible(...);
+
+//! @}
+
+//! \name
+//! \brief Check if `T` can be aggregate-initialized with `N` empty initializer lists
+//!
+//! Unlike `any_field` instances, empty initializer lists are never spread over the elements of a C-style array field,
+//! so each of them initializes exactly one field.
+//! @{
+
+template<typename T>
+std::false_type is_value_constructible(...);
+
+#define UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(N, ...)                                                                      \
+  template<typename T>                                                                                                 \
+  auto is_value_constructible(std::integral_constant<std::size_t, N>) -> decltype(T{__VA_ARGS__}, std::true_type{});
+
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(1, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(2, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(3, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(4, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(5, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(6, {}, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(7, {}, {}, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(8, {}, {}, {}, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(9, {}, {}, {}, {}, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(10, {}, {}, {}, {}, {}, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(11, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(12, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(13, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(14, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(15, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(16, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {})
+UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE(17, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {})
+
+#undef UPD_DETAIL_IS_VALUE_CONSTRUCTIBLE
+
+//! @}
+
+//! \name
+//! \brief Number of initializers accepted by the aggregate `T`, found by initializing it with as many `any_field` as
+//! possible
+//!
+//! The elements of C-style array fields are counted one by one, since the braces around them may be elided. The count
+//! goes one past `max_reflected_field_count`, so that larger aggregates can be rejected.
+//! @{
+
+template<typename T, std::size_t N = max_reflected_field_count + 1>
+struct initializer_count
+    : std::conditional<decltype(is_brace_constructible<T>(make_index_sequence<N>{}))::value,
+                       std::integral_constant<std::size_t, N>,
+                       initializer_count<T, N - 1>>::type {};
+template<typename T>
+struct initializer_count<T, 0> : std::integral_constant<std::size_t, 0> {};
+
+//! @}
+
+//! \name
+//! \brief Number of fields of the aggregate `T`, found by initializing it with as many empty initializer lists as
+//! possible
+//!
+//! This is zero if one of the fields cannot be value-initialized. As with `initializer_count`, the count goes one past
+//! `max_reflected_field_count`.
+//! @{
+
+template<typename T, std::size_t N = max_reflected_field_count + 1>
+struct field_count
+    : std::conditional<decltype(is_value_constructible<T>(std::integral_constant<std::size_t, N>{}))::value,
+                       std::integral_constant<std::size_t, N>,
+                       field_count<T, N - 1>>::type {};
+template<typename T>
+struct field_count<T, 0> : std::integral_constant<std::size_t, 0> {};
+
+//! @}
+
+//! \brief Check if the aggregate `T` has a base class
+template<typename T>
+struct has_base : decltype(is_brace_constructible_from_base<T>(0)) {};
+
+//! \brief Check if `T` is an aggregate whose fields can be serialized without a user-provided extension
+//!
+//! `T` must have between 1 and `max_reflected_field_count` fields, no base classes and no C-style array fields
+//! (`std::array` fields are fine), so that it can be decomposed with a structured binding. These requirements are
+//! checked here, so that other types are only reported as not serializable. Bit-fields are serialized as their declared
+//! type.
+template<typename T>
+struct is_reflectable
+    : std::conjunction<std::is_class<T>,
+                       std::is_aggregate<T>,
+                       std::negation<is_array<T>>,
+                       std::negation<is_user_serializable<T>>,
+                       std::negation<has_base<T>>,
+                       std::integral_constant<bool,
+                                              field_count<T>::value != 0 &&
+                                                  field_count<T>::value <= max_reflected_field_count &&
+                                                  field_count<T>::value == initializer_count<T>::value>> {};
+
+//! \name
+//! \brief Invoke `ftor` on references to every field of an aggregate
+//! @{
+
+#define UPD_DETAIL_VISIT_FIELDS(N, ...)                                                                                \
+  template<typename T, typename F>                                                                                     \
+  decltype(auto) visit_fields(T &x, F &&ftor, std::integral_constant<std::size_t, N>) {                                \
+    auto &[__VA_ARGS__] = x;                                                                                           \
+    return static_cast<F &&>(ftor)(__VA_ARGS__);                                                                       \
+  }
+
+UPD_DETAIL_VISIT_FIELDS(1, f0)
+UPD_DETAIL_VISIT_FIELDS(2, f0, f1)
+UPD_DETAIL_VISIT_FIELDS(3, f0, f1, f2)
+UPD_DETAIL_VISIT_FIELDS(4, f0, f1, f2, f3)
+UPD_DETAIL_VISIT_FIELDS(5, f0, f1, f2, f3, f4)
+UPD_DETAIL_VISIT_FIELDS(6, f0, f1, f2, f3, f4, f5)
+UPD_DETAIL_VISIT_FIELDS(7, f0, f1, f2, f3, f4, f5, f6)
+UPD_DETAIL_VISIT_FIELDS(8, f0, f1, f2, f3, f4, f5, f6, f7)
+UPD_DETAIL_VISIT_FIELDS(9, f0, f1, f2, f3, f4, f5, f6, f7, f8)
+UPD_DETAIL_VISIT_FIELDS(10, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9)
+UPD_DETAIL_VISIT_FIELDS(11, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10)
+UPD_DETAIL_VISIT_FIELDS(12, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11)
+UPD_DETAIL_VISIT_FIELDS(13, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12)
+UPD_DETAIL_VISIT_FIELDS(14, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13)
+UPD_DETAIL_VISIT_FIELDS(15, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14)
+UPD_DETAIL_VISIT_FIELDS(16, f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15)
+
+#undef UPD_DETAIL_VISIT_FIELDS
+
+template<typename T, typename F>
+decltype(auto) visit_fields(T &x, F &&ftor) {
+  return visit_fields(x, static_cast<F &&>(ftor), field_count<typename std::remove_const<T>::type>{});
+}
+
+//! @}
+
+//! \brief Functor whose return type is a typelist holding the types of the fields it is invoked on
+//!
+//! The fields are taken by constant reference, so that bit-fields can be bound.
+struct field_types_collector {
+  template<typename... Ts>
+  upd::typelist_t<Ts...> operator()(const Ts &...) const;
+};
+
+//! \brief Typelist holding the types of the fields of the aggregate `T`
+template<typename T>
+using field_types_t = decltype(visit_fields(std::declval<T &>(), field_types_collector{}));
+
+//! \brief Aggregate-initialize an instance of `T` with the values returned by `ftor` for each of its fields
+//!
+//! `ftor` is invoked in order on a null pointer to the type of each field. Unlike assigning the fields through
+//! `visit_fields`, this also works with bit-fields.
+template<typename T, typename F, typename... Fs>
+T make_aggregate(F &&ftor, upd::typelist_t<Fs...>) {
+  return T{ftor(static_cast<Fs *>(nullptr))...};
+}
+
+#else  // __cplusplus >= 201703L
+
+template<typename T>
+struct is_reflectable : std::false_type {};
+
+#endif // __cplusplus >= 201703L
+
+} // namespace detail
+} // namespace upd
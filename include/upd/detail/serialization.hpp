@@ -2,15 +2,21 @@
 
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <iterator> // IWYU pragma: keep
 #include <type_traits>
 
 #include "../format.hpp"
 #include "../type.hpp"
+#include "../typelist.hpp"
 #include "../upd.hpp"
 #include "endianess.hpp"
+#include "reflection.hpp"
 #include "signed_representation.hpp"
 #include "type_traits/detector.hpp"
+#include "type_traits/is_ieee754.hpp"
+#include "type_traits/iterator_category.hpp"
+#include "type_traits/remove_cv_ref.hpp"
 #include "type_traits/require.hpp"
 #include "type_traits/signature.hpp"
 
@@ -21,6 +27,15 @@ class tuple_view; // IWYU pragma: keep
 
 namespace detail {
 
+template<typename T>
+struct serialization_size; // IWYU pragma: keep
+
+template<typename T>
+struct is_serializable; // IWYU pragma: keep
+
+template<endianess Endianess, signed_mode Signed_Mode, typename T>
+struct has_native_representation; // IWYU pragma: keep
+
 //! \brief Make a tuple view suitable for functors of the provided signature to invoke on
 template<endianess Endianess, signed_mode Signed_Mode, typename It, typename... Args, typename R>
 tuple_view<It, Endianess, Signed_Mode, Args...> make_view_for(const It &it, signature<R(Args...)>) {
@@ -46,35 +61,167 @@ using array_t = typename array_t_impl<T>::type;
 
 //! @}
 
+//! \name
+//! \brief Get a pointer to the first element of an array
+//! @{
+
+template<typename T, std::size_t N>
+const T *data_of(const T (&array)[N]) {
+  return array;
+}
+template<typename T, std::size_t N>
+const T *data_of(const std::array<T, N> &array) {
+  return array.data();
+}
+
+//! @}
+
+//! \brief Indicates whether arrays of `T` are serialized in bulk
+//!
+//! Arrays of integers (excepted `bool`) are serialized in bulk, as well as arrays of IEEE 754 floating-point values if
+//! the platform endianess is known. The other arrays are serialized element by element.
+template<typename T>
+struct is_bulk_serializable
+    : std::integral_constant<bool,
+                             (std::is_integral<T>::value && !std::is_same<T, bool>::value) ||
+                                 (is_ieee754<T>::value && (platform_info.endianess == endianess::LITTLE ||
+                                                           platform_info.endianess == endianess::BIG))> {};
+
+#if __cplusplus >= 201703L
+//! \name
+//! \brief Sum of the serialization sizes of the types held by a typelist
+//! @{
+
+template<typename>
+struct sum_of_serialization_sizes;
+template<typename... Ts>
+struct sum_of_serialization_sizes<upd::typelist_t<Ts...>>
+    : std::integral_constant<std::size_t, (serialization_size<Ts>::value + ... + 0)> {};
+
+//! @}
+
+//! \name
+//! \brief Check if every field of the aggregate `T` is serializable
+//! @{
+
+template<typename>
+struct are_serializable;
+template<typename... Ts>
+struct are_serializable<upd::typelist_t<Ts...>> : std::conjunction<is_serializable<Ts>...> {};
+
+template<typename T>
+struct has_serializable_fields : are_serializable<field_types_t<T>> {};
+
+//! @}
+
+//! \brief Check if `T` is an aggregate serialized through reflection, field after field
+//!
+//! Aggregates with a user-provided extension are serialized through it instead.
+template<typename T>
+struct is_serializable_aggregate : std::conjunction<is_reflectable<T>, has_serializable_fields<T>> {};
+
+//! \name
+//! \brief Check if the serialized representation of the aggregate `T` is its object representation on this platform
+//!
+//! This is the case if `T` is trivially copyable, has no padding and every field satisfies `has_native_representation`.
+//! @{
+
+template<endianess Endianess, signed_mode Signed_Mode, typename T, typename = field_types_t<T>>
+struct has_native_aggregate_layout;
+template<endianess Endianess, signed_mode Signed_Mode, typename T, typename... Fs>
+struct has_native_aggregate_layout<Endianess, Signed_Mode, T, upd::typelist_t<Fs...>>
+    : std::integral_constant<bool,
+                             std::is_trivially_copyable<T>::value &&
+                                 sizeof(T) == sum_of_serialization_sizes<upd::typelist_t<Fs...>>::value &&
+                                 (has_native_representation<Endianess, Signed_Mode, Fs>::value && ...)> {};
+
+//! @}
+#else  // __cplusplus >= 201703L
+template<typename T>
+struct is_serializable_aggregate : std::false_type {};
+#endif // __cplusplus >= 201703L
+
+template<endianess Endianess, signed_mode Signed_Mode, typename T>
+void read_n_as(const byte_t *sequence, T *values, std::size_t count);
+
+template<endianess Endianess, signed_mode Signed_Mode, typename T>
+void write_n_as(const T *values, byte_t *sequence, std::size_t count);
+
 //! \brief Interpret a part of a byte sequence as a value of the given type
 //! \tparam T Requested type
 //! \tparam Endianess Endianess of the value representation in the byte sequence
 //! \tparam Signed_Mode Signed number representation of the value representation in the byte sequence
 //! \param begin Iterator to a byte sequence to interpret from
 //! \return A copy of the value represented by the byte sequence
+//!
+//! Since C++17, aggregates without a user-provided extension are unserialized field after field, or with a single
+//! `memcpy` if their layout matches their serialized representation (see `has_native_aggregate_layout`).
+//!
+//! If `begin` is an iterator to a contiguous byte sequence (such as `std::vector<byte_t>::iterator`), the sequence is
+//! read in place. If `begin` is a \ref<segmented_iterator> segmented_iterator, the sequence is read in place unless it
+//! straddles both segments. Otherwise, it is first copied byte by byte into a temporary buffer.
+//!
+//! Since C++17, integers can be read from a pointer in constant expressions.
 #ifdef DOXYGEN
 template<typename It, typename T, endianess Endianess, signed_mode Signed_Mode>
 T read_as(It begin);
 #else
 template<typename T, endianess Endianess, signed_mode, detail::require_unsigned_integer<T> = 0>
-T read_as(const byte_t *sequence) {
-  return detail::from_endianess<T, Endianess>(sequence, sizeof(T));
+UPD_CONSTEXPR17 T read_as(const byte_t *sequence) {
+  using representation_t = typename std::conditional<std::is_same<T, bool>::value, unsigned char, T>::type;
+  return T(detail::from_endianess<representation_t, Endianess>(sequence, sizeof(T)));
 }
 template<typename T, endianess Endianess, signed_mode Signed_Mode, detail::require_signed_integer<T> = 0>
-T read_as(const byte_t *sequence) {
-  auto tmp = detail::from_endianess<unsigned long long, Endianess>(sequence, sizeof(T));
+UPD_CONSTEXPR17 T read_as(const byte_t *sequence) {
+  using unsigned_t = typename std::make_unsigned<T>::type;
+  auto tmp = detail::from_endianess<unsigned_t, Endianess>(sequence, sizeof(T));
 
   return detail::from_signed_mode<T, Signed_Mode>(tmp);
 }
+template<typename T, endianess Endianess, signed_mode, detail::require_ieee754<T> = 0>
+T read_as(const byte_t *sequence) {
+  auto representation = detail::from_endianess<detail::ieee754_representation_t<T>, Endianess>(sequence, sizeof(T));
+
+  T retval;
+  memcpy(&retval, &representation, sizeof retval);
+  return retval;
+}
 template<typename T, endianess Endianess, signed_mode Signed_Mode, detail::require_array<T> = 0>
 detail::array_t<T> read_as(const byte_t *sequence) {
   detail::array_t<T> retval;
+  read_n_as<Endianess, Signed_Mode>(sequence, retval.data(), retval.size());
+
+  return retval;
+}
+template<typename T, endianess Endianess, signed_mode, detail::require_packed<T> = 0>
+T read_as(const byte_t *sequence) {
+  T retval;
+  detail::copy_in_endianess<Endianess>(retval.begin(), sequence, T::size);
+  return retval;
+}
+template<typename T, endianess Endianess, signed_mode Signed_Mode, detail::require_integer_represented<T> = 0>
+UPD_CONSTEXPR17 T read_as(const byte_t *sequence) {
+  return T::from_raw(read_as<typename T::representation_t, Endianess, Signed_Mode>(sequence));
+}
+template<typename T, endianess Endianess, signed_mode, detail::require_unsigned_int_n<T> = 0>
+UPD_CONSTEXPR17 T read_as(const byte_t *sequence) {
+  return T(detail::from_endianess<typename T::value_t, Endianess>(sequence, T::size));
+}
+template<typename T, endianess Endianess, signed_mode Signed_Mode, detail::require_signed_int_n<T> = 0>
+UPD_CONSTEXPR17 T read_as(const byte_t *sequence) {
+  using value_t = typename T::value_t;
+  using unsigned_t = typename std::make_unsigned<value_t>::type;
+  auto tmp = detail::from_endianess<unsigned_t, Endianess>(sequence, T::size);
 
-  using element_t = typename std::remove_reference<decltype(retval[0])>::type;
-  constexpr auto size = retval.size();
+  return T(detail::from_signed_mode<value_t, Signed_Mode, T::width>(tmp));
+}
+template<typename T, endianess Endianess, signed_mode Signed_Mode, detail::require_bounded<T> = 0>
+T read_as(const byte_t *sequence) {
+  using length_t = typename T::length_t;
 
-  for (std::size_t i = 0; i < size; i++)
-    retval[i] = read_as<element_t, Endianess, Signed_Mode>(sequence + i * sizeof(element_t));
+  T retval;
+  retval.resize(read_as<length_t, Endianess, Signed_Mode>(sequence));
+  read_n_as<Endianess, Signed_Mode>(sequence + sizeof(length_t), retval.data(), retval.size());
 
   return retval;
 }
@@ -84,15 +231,192 @@ T read_as(const byte_t *sequence) {
       sequence, detail::examine_invocable<decltype(upd_extension<T>::unserialize)>{});
   return view.invoke(upd_extension<T>::unserialize);
 }
-template<typename T, endianess Endianess, signed_mode Signed_Mode, typename It, detail::require_not_pointer<It> = 0>
+#if __cplusplus >= 201703L
+template<typename T,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         detail::require<detail::is_serializable_aggregate<T>::value> = 0>
+T read_as(const byte_t *sequence) {
+  if constexpr (detail::has_native_aggregate_layout<Endianess, Signed_Mode, T>::value) {
+    T retval;
+    memcpy(&retval, sequence, sizeof retval);
+    return retval;
+  } else {
+    auto offset = std::size_t(0);
+    auto read_field = [&](auto *field_ptr) {
+      using field_t = detail::remove_cv_ref_t<decltype(*field_ptr)>;
+      auto *field_sequence = sequence + offset;
+      offset += serialization_size<field_t>::value;
+      return read_as<field_t, Endianess, Signed_Mode>(field_sequence);
+    };
+    return detail::make_aggregate<T>(read_field, detail::field_types_t<T>{});
+  }
+}
+#endif // __cplusplus >= 201703L
+template<typename T,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename It,
+         detail::require<!std::is_pointer<It>::value && detail::is_contiguous_byte_iterator<It>::value> = 0>
+decltype(read_as<T, Endianess, Signed_Mode>(std::declval<byte_t *>())) read_as(It it) {
+  const byte_t *sequence = detail::to_byte_pointer(it);
+  return read_as<T, Endianess, Signed_Mode>(sequence);
+}
+template<typename T,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename It,
+         detail::require_segmented_iterator<It> = 0>
+decltype(read_as<T, Endianess, Signed_Mode>(std::declval<byte_t *>())) read_as(It it) {
+  if (it.contiguous_size() >= serialization_size<T>::value) {
+    const byte_t *sequence = it.get();
+    return read_as<T, Endianess, Signed_Mode>(sequence);
+  }
+
+  byte_t buf[serialization_size<T>::value];
+  for (byte_t &byte : buf)
+    byte = *it++;
+  return read_as<T, Endianess, Signed_Mode>(buf);
+}
+template<typename T,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         typename It,
+         detail::require<!std::is_pointer<It>::value && !detail::is_contiguous_byte_iterator<It>::value &&
+                         !detail::is_segmented_iterator<It>::value> = 0>
 decltype(read_as<T, Endianess, Signed_Mode>(std::declval<byte_t *>())) read_as(It it) {
-  byte_t buf[sizeof(T)];
+  byte_t buf[serialization_size<T>::value];
   for (byte_t &byte : buf)
     byte = *it++;
   return read_as<T, Endianess, Signed_Mode>(buf);
 }
 #endif
 
+//! \name
+//! \brief Implementations of `read_n_as`
+//! @{
+
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         detail::require<!is_bulk_serializable<T>::value && !is_integer_represented<T>::value &&
+                         !is_int_n<T>::value> = 0>
+void read_n_as_impl(const byte_t *sequence, T *values, std::size_t count) {
+  for (std::size_t i = 0; i < count; i++)
+    values[i] = read_as<T, Endianess, Signed_Mode>(sequence + i * serialization_size<T>::value);
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_integer_represented<T> = 0>
+void read_n_as_impl(const byte_t *sequence, T *values, std::size_t count) {
+  using representation_t = typename T::representation_t;
+
+  // `T` only holds its integer representation, which is unserialized in bulk by chunk
+  constexpr std::size_t chunk_size = 64;
+  representation_t chunk[chunk_size];
+  for (std::size_t i = 0; i < count; i += chunk_size) {
+    auto n = count - i < chunk_size ? count - i : chunk_size;
+    read_n_as<Endianess, Signed_Mode>(sequence + i * serialization_size<T>::value, chunk, n);
+    for (std::size_t j = 0; j < n; j++)
+      values[i + j] = T::from_raw(chunk[j]);
+  }
+}
+template<endianess Endianess, signed_mode, typename T, detail::require_unsigned_int_n<T> = 0>
+void read_n_as_impl(const byte_t *sequence, T *values, std::size_t count) {
+  using value_t = typename T::value_t;
+
+  // The integers are unpacked in bulk by chunk, then wrapped one by one
+  constexpr std::size_t chunk_size = 64;
+  value_t chunk[chunk_size];
+  for (std::size_t i = 0; i < count; i += chunk_size) {
+    auto n = count - i < chunk_size ? count - i : chunk_size;
+    detail::from_endianess_n<value_t, Endianess>(sequence + i * T::size, chunk, n, T::size);
+    for (std::size_t j = 0; j < n; j++)
+      values[i + j] = T(chunk[j]);
+  }
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_signed_int_n<T> = 0>
+void read_n_as_impl(const byte_t *sequence, T *values, std::size_t count) {
+  using value_t = typename T::value_t;
+  using unsigned_t = typename std::make_unsigned<value_t>::type;
+
+  // The representations are unpacked in bulk by chunk, then sign-extended one by one
+  constexpr std::size_t chunk_size = 64;
+  unsigned_t chunk[chunk_size];
+  for (std::size_t i = 0; i < count; i += chunk_size) {
+    auto n = count - i < chunk_size ? count - i : chunk_size;
+    detail::from_endianess_n<unsigned_t, Endianess>(sequence + i * T::size, chunk, n, T::size);
+    for (std::size_t j = 0; j < n; j++)
+      values[i + j] = T(detail::from_signed_mode<value_t, Signed_Mode, T::width>(chunk[j]));
+  }
+}
+template<endianess Endianess,
+         signed_mode,
+         typename T,
+         detail::require<is_bulk_serializable<T>::value && std::is_unsigned<T>::value> = 0>
+void read_n_as_impl(const byte_t *sequence, T *values, std::size_t count) {
+  detail::from_endianess_n<T, Endianess>(sequence, values, count);
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         detail::require<is_bulk_serializable<T>::value && std::is_integral<T>::value && std::is_signed<T>::value> = 0>
+void read_n_as_impl(const byte_t *sequence, T *values, std::size_t count) {
+  using unsigned_t = typename std::make_unsigned<T>::type;
+
+  auto *unsigned_values = reinterpret_cast<unsigned_t *>(values);
+  detail::from_endianess_n<unsigned_t, Endianess>(sequence, unsigned_values, count);
+  if (platform_info.signed_mode != Signed_Mode) {
+    for (std::size_t i = 0; i < count; i++)
+      values[i] = detail::from_signed_mode<T, Signed_Mode>(unsigned_values[i]);
+  }
+}
+
+template<endianess Endianess,
+         signed_mode,
+         typename T,
+         detail::require<is_bulk_serializable<T>::value && is_ieee754<T>::value> = 0>
+void read_n_as_impl(const byte_t *sequence, T *values, std::size_t count) {
+  using representation_t = ieee754_representation_t<T>;
+
+  // The platform endianess is known, so the values are only accessed as bytes
+  detail::from_endianess_n<representation_t, Endianess>(sequence, reinterpret_cast<representation_t *>(values), count);
+}
+
+//! @}
+
+//! \brief Interpret a byte sequence as `count` consecutive values of the given type
+//!
+//! Arrays of integers and IEEE 754 floating-point values are unserialized in bulk: their byte order is fixed with a
+//! single `memcpy` followed, if needed, by a vectorized byte swap. Then the signed representation of integers is
+//! converted element by element if needed.
+//!
+//! \tparam Endianess Endianess of the values representation in the byte sequence
+//! \tparam Signed_Mode Signed number representation of the values representation in the byte sequence
+//! \param sequence Byte sequence to interpret from
+//! \param values Array to write the values into
+//! \param count Number of values to unserialize
+template<endianess Endianess, signed_mode Signed_Mode, typename T>
+void read_n_as(const byte_t *sequence, T *values, std::size_t count) {
+  read_n_as_impl<Endianess, Signed_Mode>(sequence, values, count);
+}
+
+//! \brief Interpret a byte sequence as `count` values of the given type, laid out every `stride` bytes
+//!
+//! The values are read in a single loop with a constant stride, which compilers are able to vectorize for integers and
+//! IEEE 754 floating-point values.
+//!
+//! \tparam T Requested type (or the corresponding `std::array` instance for array types)
+//! \tparam Endianess Endianess of the values representation in the byte sequence
+//! \tparam Signed_Mode Signed number representation of the values representation in the byte sequence
+//! \param sequence Byte sequence to interpret from
+//! \param stride Distance in bytes between two consecutive values in the byte sequence
+//! \param values Array to write the values into
+//! \param count Number of values to unserialize
+template<typename T, endianess Endianess, signed_mode Signed_Mode, typename U>
+void read_strided_as(const byte_t *sequence, std::size_t stride, U *values, std::size_t count) {
+  for (std::size_t i = 0; i < count; i++)
+    values[i] = read_as<T, Endianess, Signed_Mode>(sequence + i * stride);
+}
+
 //! \brief Interpret a part of a byte sequence as a value of the given type at the given offset
 //! \tparam T requested type
 //! \tparam Endianess endianess of the value representation in the byte sequence
@@ -109,7 +433,8 @@ template<typename T,
          signed_mode Signed_Mode,
          typename It,
          UPD_REQUIREMENT(input_byte_iterator, It)>
-decltype(read_as<T, Endianess, Signed_Mode>(std::declval<byte_t *>())) read_as(const It &begin, std::size_t offset) {
+UPD_CONSTEXPR17 decltype(read_as<T, Endianess, Signed_Mode>(std::declval<byte_t *>()))
+read_as(const It &begin, std::size_t offset) {
   return read_as<T, Endianess, Signed_Mode>(std::next(begin, offset));
 }
 #endif
@@ -120,26 +445,68 @@ decltype(read_as<T, Endianess, Signed_Mode>(std::declval<byte_t *>())) read_as(c
 //! \tparam T Serilized value's type
 //! \param x Value to be serialized
 //! \param begin Iterator to a byte sequence to write into
+//!
+//! If `begin` is an iterator to a contiguous byte sequence, the value is serialized in place. If `begin` is a
+//! \ref<segmented_iterator> segmented_iterator, the value is serialized in place unless its representation straddles
+//! both segments. Otherwise, it is serialized into a temporary buffer which is then copied byte by byte.
+//!
+//! Since C++17, integers can be written through a pointer in constant expressions.
 #ifdef DOXYGEN
     template<endianess Endianess, signed_mode Signed_Mode, typename T>
     void write_as(const T &x, It begin);
 #else
 template<endianess Endianess, signed_mode, typename T, detail::require_unsigned_integer<T> = 0>
-void write_as(const T &x, byte_t *sequence) {
+UPD_CONSTEXPR17 void write_as(const T &x, byte_t *sequence) {
   detail::to_endianess<Endianess>(sequence, x, sizeof(x));
 }
 template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_signed_integer<T> = 0>
-void write_as(const T &x, byte_t *sequence) {
+UPD_CONSTEXPR17 void write_as(const T &x, byte_t *sequence) {
   auto tmp = detail::to_signed_mode<Signed_Mode>(x);
 
   detail::to_endianess<Endianess>(sequence, tmp, sizeof(x));
 }
+template<endianess Endianess, signed_mode, typename T, detail::require_ieee754<T> = 0>
+void write_as(const T &x, byte_t *sequence) {
+  detail::ieee754_representation_t<T> representation;
+  memcpy(&representation, &x, sizeof x);
+
+  detail::to_endianess<Endianess>(sequence, representation, sizeof x);
+}
 template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_array<T> = 0>
 void write_as(const T &array, byte_t *sequence) {
-  using element_t = decltype(array[0]);
   constexpr auto array_size = sizeof(array) / sizeof(array[0]);
-  for (std::size_t i = 0; i < array_size; i++)
-    write_as<Endianess, Signed_Mode>(array[i], sequence + i * sizeof(element_t));
+  write_n_as<Endianess, Signed_Mode>(detail::data_of(array), sequence, array_size);
+}
+template<endianess Endianess, signed_mode, typename T, detail::require_packed<T> = 0>
+void write_as(const T &x, byte_t *sequence) {
+  detail::copy_in_endianess<Endianess>(sequence, x.begin(), T::size);
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_integer_represented<T> = 0>
+UPD_CONSTEXPR17 void write_as(const T &x, byte_t *sequence) {
+  write_as<Endianess, Signed_Mode>(x.raw(), sequence);
+}
+template<endianess Endianess, signed_mode, typename T, detail::require_unsigned_int_n<T> = 0>
+UPD_CONSTEXPR17 void write_as(const T &x, byte_t *sequence) {
+  detail::to_endianess<Endianess>(sequence, x.value(), T::size);
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_signed_int_n<T> = 0>
+UPD_CONSTEXPR17 void write_as(const T &x, byte_t *sequence) {
+  auto tmp = detail::to_signed_mode<Signed_Mode, typename T::value_t, T::width>(x.value());
+
+  detail::to_endianess<Endianess>(sequence, tmp, T::size);
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_bounded<T> = 0>
+void write_as(const T &x, byte_t *sequence) {
+  using element_t = typename T::value_type;
+  using length_t = typename T::length_t;
+  constexpr auto element_size = serialization_size<element_t>::value;
+
+  write_as<Endianess, Signed_Mode>(length_t(x.size()), sequence);
+  sequence += sizeof(length_t);
+  write_n_as<Endianess, Signed_Mode>(x.data(), sequence, x.size());
+
+  // The unused elements are zeroed so that the content of the storage only depends on the value
+  memset(sequence + x.size() * element_size, 0, (T::capacity - x.size()) * element_size);
 }
 template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_is_user_serializable<T> = 0>
 void write_as(const T &x, byte_t *sequence) {
@@ -147,9 +514,56 @@ void write_as(const T &x, byte_t *sequence) {
       sequence, detail::examine_invocable<decltype(upd_extension<T>::unserialize)>{});
   upd_extension<T>::serialize(x, view);
 }
-template<endianess Endianess, signed_mode Signed_Mode, typename T, typename It, detail::require_not_pointer<It> = 0>
+#if __cplusplus >= 201703L
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         detail::require<detail::is_serializable_aggregate<T>::value> = 0>
+void write_as(const T &x, byte_t *sequence) {
+  if constexpr (detail::has_native_aggregate_layout<Endianess, Signed_Mode, T>::value) {
+    memcpy(sequence, &x, sizeof x);
+  } else {
+    detail::visit_fields(x, [&](const auto &...fields) {
+      auto offset = std::size_t(0);
+      ((write_as<Endianess, Signed_Mode>(fields, sequence + offset),
+        offset += serialization_size<detail::remove_cv_ref_t<decltype(fields)>>::value),
+       ...);
+    });
+  }
+}
+#endif // __cplusplus >= 201703L
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename It,
+         detail::require<!std::is_pointer<It>::value && detail::is_contiguous_byte_iterator<It>::value> = 0>
+void write_as(const T &value, It it) {
+  byte_t *sequence = detail::to_byte_pointer(it);
+  write_as<Endianess, Signed_Mode>(value, sequence);
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename It,
+         detail::require_segmented_iterator<It> = 0>
+void write_as(const T &value, It it) {
+  if (it.contiguous_size() >= serialization_size<T>::value)
+    return write_as<Endianess, Signed_Mode>(value, it.get());
+
+  byte_t buf[serialization_size<T>::value];
+
+  write_as<Endianess, Signed_Mode>(value, buf);
+  for (const byte_t &byte : buf)
+    *it++ = byte;
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         typename It,
+         detail::require<!std::is_pointer<It>::value && !detail::is_contiguous_byte_iterator<It>::value &&
+                         !detail::is_segmented_iterator<It>::value> = 0>
 void write_as(const T &value, It it) {
-  byte_t buf[sizeof(T)];
+  byte_t buf[serialization_size<T>::value];
 
   write_as<Endianess, Signed_Mode>(value, buf);
   for (const byte_t &byte : buf)
@@ -157,6 +571,133 @@ void write_as(const T &value, It it) {
 }
 #endif
 
+//! \name
+//! \brief Implementations of `write_n_as`
+//! @{
+
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         detail::require<!is_bulk_serializable<T>::value && !is_integer_represented<T>::value &&
+                         !is_int_n<T>::value> = 0>
+void write_n_as_impl(const T *values, byte_t *sequence, std::size_t count) {
+  for (std::size_t i = 0; i < count; i++)
+    write_as<Endianess, Signed_Mode>(values[i], sequence + i * serialization_size<T>::value);
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_integer_represented<T> = 0>
+void write_n_as_impl(const T *values, byte_t *sequence, std::size_t count) {
+  using representation_t = typename T::representation_t;
+
+  // `T` only holds its integer representation, which is serialized in bulk by chunk
+  constexpr std::size_t chunk_size = 64;
+  representation_t chunk[chunk_size];
+  for (std::size_t i = 0; i < count; i += chunk_size) {
+    auto n = count - i < chunk_size ? count - i : chunk_size;
+    for (std::size_t j = 0; j < n; j++)
+      chunk[j] = values[i + j].raw();
+    write_n_as<Endianess, Signed_Mode>(chunk, sequence + i * serialization_size<T>::value, n);
+  }
+}
+template<endianess Endianess, signed_mode, typename T, detail::require_unsigned_int_n<T> = 0>
+void write_n_as_impl(const T *values, byte_t *sequence, std::size_t count) {
+  using value_t = typename T::value_t;
+
+  // The integers are unwrapped by chunk so they can still be packed in bulk
+  constexpr std::size_t chunk_size = 64;
+  value_t chunk[chunk_size];
+  for (std::size_t i = 0; i < count; i += chunk_size) {
+    auto n = count - i < chunk_size ? count - i : chunk_size;
+    for (std::size_t j = 0; j < n; j++)
+      chunk[j] = values[i + j].value();
+    detail::to_endianess_n<Endianess>(sequence + i * T::size, chunk, n, T::size);
+  }
+}
+template<endianess Endianess, signed_mode Signed_Mode, typename T, detail::require_signed_int_n<T> = 0>
+void write_n_as_impl(const T *values, byte_t *sequence, std::size_t count) {
+  using value_t = typename T::value_t;
+  using unsigned_t = typename std::make_unsigned<value_t>::type;
+
+  // As with standard signed integers, the signed representation is computed by chunk
+  constexpr std::size_t chunk_size = 64;
+  unsigned_t chunk[chunk_size];
+  for (std::size_t i = 0; i < count; i += chunk_size) {
+    auto n = count - i < chunk_size ? count - i : chunk_size;
+    for (std::size_t j = 0; j < n; j++)
+      chunk[j] = detail::to_signed_mode<Signed_Mode, value_t, T::width>(values[i + j].value());
+    detail::to_endianess_n<Endianess>(sequence + i * T::size, chunk, n, T::size);
+  }
+}
+template<endianess Endianess,
+         signed_mode,
+         typename T,
+         detail::require<is_bulk_serializable<T>::value && std::is_unsigned<T>::value> = 0>
+void write_n_as_impl(const T *values, byte_t *sequence, std::size_t count) {
+  detail::to_endianess_n<Endianess>(sequence, values, count);
+}
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         typename T,
+         detail::require<is_bulk_serializable<T>::value && std::is_integral<T>::value && std::is_signed<T>::value> = 0>
+void write_n_as_impl(const T *values, byte_t *sequence, std::size_t count) {
+  using unsigned_t = typename std::make_unsigned<T>::type;
+
+  if (platform_info.signed_mode == Signed_Mode)
+    return detail::to_endianess_n<Endianess>(sequence, reinterpret_cast<const unsigned_t *>(values), count);
+
+  // The signed representation is converted by chunk so the byte order can still be fixed in bulk
+  constexpr std::size_t chunk_size = 64;
+  unsigned_t chunk[chunk_size];
+  for (std::size_t i = 0; i < count; i += chunk_size) {
+    auto n = count - i < chunk_size ? count - i : chunk_size;
+    for (std::size_t j = 0; j < n; j++)
+      chunk[j] = detail::to_signed_mode<Signed_Mode>(values[i + j]);
+    detail::to_endianess_n<Endianess>(sequence + i * sizeof(T), chunk, n);
+  }
+}
+
+template<endianess Endianess,
+         signed_mode,
+         typename T,
+         detail::require<is_bulk_serializable<T>::value && is_ieee754<T>::value> = 0>
+void write_n_as_impl(const T *values, byte_t *sequence, std::size_t count) {
+  using representation_t = ieee754_representation_t<T>;
+
+  // The platform endianess is known, so the values are only accessed as bytes
+  detail::to_endianess_n<Endianess>(sequence, reinterpret_cast<const representation_t *>(values), count);
+}
+
+//! @}
+
+//! \brief Serialize `count` consecutive values into a byte sequence
+//!
+//! \copydetails read_n_as
+//!
+//! \tparam Endianess Endianess of the values representation in the byte sequence
+//! \tparam Signed_Mode Signed number representation of the values representation in the byte sequence
+//! \param values Array of values to be serialized
+//! \param sequence Byte sequence to write into
+//! \param count Number of values to serialize
+template<endianess Endianess, signed_mode Signed_Mode, typename T>
+void write_n_as(const T *values, byte_t *sequence, std::size_t count) {
+  write_n_as_impl<Endianess, Signed_Mode>(values, sequence, count);
+}
+
+//! \brief Serialize `count` values into a byte sequence, every `stride` bytes
+//!
+//! \copydetails read_strided_as
+//!
+//! \tparam Endianess Endianess of the values representation in the byte sequence
+//! \tparam Signed_Mode Signed number representation of the values representation in the byte sequence
+//! \param values Array of values to be serialized
+//! \param sequence Byte sequence to write into
+//! \param stride Distance in bytes between two consecutive values in the byte sequence
+//! \param count Number of values to serialize
+template<endianess Endianess, signed_mode Signed_Mode, typename T>
+void write_strided_as(const T *values, byte_t *sequence, std::size_t stride, std::size_t count) {
+  for (std::size_t i = 0; i < count; i++)
+    write_as<Endianess, Signed_Mode>(values[i], sequence + i * stride);
+}
+
 //! \brief Serialize a value into a byte sequence at the given offset
 //! \tparam Endianess endianess of the value representation in the byte sequence
 //! \tparam Signed_Mode signed number representation of the value representation in the byte sequence
@@ -174,11 +715,68 @@ template<endianess Endianess,
          typename T,
          typename It,
          UPD_REQUIREMENT(output_byte_iterator, It)>
-void write_as(const T &value, const It &begin, std::size_t offset) {
+UPD_CONSTEXPR17 void write_as(const T &value, const It &begin, std::size_t offset) {
   write_as<Endianess, Signed_Mode>(value, std::next(begin, offset));
 }
 #endif
 
+//! \name
+//! \brief Indicates whether the serialized representation of `T` is its object representation on this platform
+//!
+//! This is the case for integers (excepted `bool`) whose endianess and signed representation match the platform ones,
+//! for IEEE 754 floating-point values whose endianess matches the platform one, and for arrays of such values.
+//! @{
+
+template<endianess Endianess, signed_mode Signed_Mode, typename T>
+struct has_native_representation
+    : std::integral_constant<bool,
+                             (std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                              (sizeof(T) == 1 || platform_info.endianess == Endianess) &&
+                              (std::is_unsigned<T>::value || platform_info.signed_mode == Signed_Mode)) ||
+                                 (is_ieee754<T>::value && platform_info.endianess == Endianess)> {};
+template<endianess Endianess, signed_mode Signed_Mode, typename T, std::size_t N>
+struct has_native_representation<Endianess, Signed_Mode, T[N]> : has_native_representation<Endianess, Signed_Mode, T> {
+};
+template<endianess Endianess, signed_mode Signed_Mode, typename T, std::size_t N>
+struct has_native_representation<Endianess, Signed_Mode, std::array<T, N>>
+    : std::integral_constant<bool,
+                             has_native_representation<Endianess, Signed_Mode, T>::value &&
+                                 sizeof(std::array<T, N>) == N * sizeof(T)> {};
+
+//! @}
+
+//! \name
+//! \brief Copy the object representation of a value from or into a byte sequence
+//!
+//! `T` must satisfy `has_native_representation`, so that it is equivalent to calling `read_as` and `write_as`.
+//! @{
+
+template<typename T, detail::require_not_array<T> = 0>
+T read_native(const byte_t *sequence) {
+  T retval;
+  memcpy(&retval, sequence, sizeof retval);
+  return retval;
+}
+template<typename T, detail::require_array<T> = 0>
+detail::array_t<T> read_native(const byte_t *sequence) {
+  detail::array_t<T> retval;
+  memcpy(retval.data(), sequence, sizeof(T));
+  return retval;
+}
+
+template<typename T, typename U, detail::require_not_array<T> = 0>
+void write_native(const U &value, byte_t *sequence) {
+  const T x = value;
+  memcpy(sequence, &x, sizeof x);
+}
+template<typename T, typename U, detail::require_array<T> = 0>
+void write_native(const U &array, byte_t *sequence) {
+  static_assert(sizeof array == sizeof(T), "Array size does not match");
+  memcpy(sequence, &array, sizeof(T));
+}
+
+//! @}
+
 UPD_DETAIL_MAKE_DETECTOR(
     is_serializable_impl,
     UPD_PACK(typename T),
@@ -193,5 +791,40 @@ struct is_serializable : decltype(is_serializable_impl<T>(0)) {};
 template<typename T, typename U = int>
 using require_is_serializable = require<is_serializable<T>::value, U>;
 
+//! \brief Return the size in bytes occupied by the serialization of instances of the provided type (if serializable)
+template<typename T, detail::require_is_serializable<T> = 0>
+constexpr std::size_t serialization_size_impl(...) {
+  return sizeof(T);
+}
+template<typename T, detail::require_is_user_serializable<T> = 0>
+constexpr std::size_t serialization_size_impl(int) {
+  return decltype(make_view_for<endianess::LITTLE, signed_mode::TWOS_COMPLEMENT>(
+      (byte_t *)nullptr, examine_invocable<decltype(upd_extension<T>::unserialize)>{}))::size;
+}
+template<typename T, detail::require<is_int_n<T>::value> = 0>
+constexpr std::size_t serialization_size_impl(int) {
+  return T::size;
+}
+template<typename T, detail::require_array<T> = 0>
+constexpr std::size_t serialization_size_impl(int) {
+  return std::tuple_size<array_t<T>>::value * serialization_size_impl<typename array_t<T>::value_type>(0);
+}
+template<typename T, detail::require_bounded<T> = 0>
+constexpr std::size_t serialization_size_impl(int) {
+  return sizeof(typename T::length_t) + T::capacity * serialization_size_impl<typename T::value_type>(0);
+}
+#if __cplusplus >= 201703L
+template<typename T, detail::require<is_serializable_aggregate<T>::value> = 0>
+constexpr std::size_t serialization_size_impl(int) {
+  return sum_of_serialization_sizes<field_types_t<T>>::value;
+}
+#endif // __cplusplus >= 201703L
+
+//! \brief Return the size in bytes occupied by the serialization of instances of the provided type (if serializable)
+template<typename T>
+struct serialization_size {
+  constexpr static auto value = serialization_size_impl<T>(0);
+};
+
 } // namespace detail
 } // namespace upd
@@ -2,11 +2,15 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+
 #include "../format.hpp"
 #include "../tuple.hpp"
 
 #include "io/immediate_writer.hpp"
 #include "type_traits/require.hpp"
+#include "encoding.hpp"
 
 namespace upd {
 namespace detail {
@@ -14,11 +18,23 @@ namespace detail {
 //! \brief Simple wrapper around 'tuple' whose content can be forwarded to a functor as a byte sequence
 //! \details
 //!   The content can be forwarded with the 'operator>>' function member. 'detail::serialized_message' object
-//!   cannot be copied from to avoid unintentional copy.
-template<endianess Endianess, signed_mode Signed_Mode, typename... Ts>
-struct serialized_message : detail::immediate_writer<serialized_message<Endianess, Signed_Mode, Ts...>> {
+//!   cannot be copied from to avoid unintentional copy. The index is always output with its fixed width, so the callee
+//!   can identify the action whatever the integer encoding of the payload is.
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         typename Index_T,
+         typename... Ts>
+struct serialized_message
+    : detail::immediate_writer<serialized_message<Endianess, Signed_Mode, Integer_Encoding, Index_T, Ts...>> {
+  using this_t = serialized_message<Endianess, Signed_Mode, Integer_Encoding, Index_T, Ts...>;
+
+  //! \brief Length in bytes of the packet if it does not depend on the content
+  constexpr static auto fixed_length = sizeof(Index_T) + tuple<Endianess, Signed_Mode, Ts...>::size;
+
   //! \brief Store the payload
-  serialized_message(const Ts &...values) : content{values...} {}
+  UPD_CONSTEXPR17 serialized_message(const Index_T &index_value, const Ts &...values)
+      : index{index_value}, content{values...} {}
 
   serialized_message(const serialized_message &) = delete;
   serialized_message(serialized_message &&) = default;
@@ -26,15 +42,35 @@ struct serialized_message : detail::immediate_writer<serialized_message<Endianes
   serialized_message &operator=(const serialized_message &) = delete;
   serialized_message &operator=(serialized_message &&) = default;
 
-  using detail::immediate_writer<serialized_message<Endianess, Signed_Mode, Ts...>>::write_to;
+  using detail::immediate_writer<this_t>::write_to;
 
   //! \brief Completely output the payload represented by the key
   template<typename Dest_F, UPD_REQUIREMENT(output_invocable, Dest_F)>
-  void write_to(Dest_F &&insert_byte) const {
-    for (auto byte : content)
+  UPD_CONSTEXPR17 void write_to(Dest_F &&insert_byte) const {
+    for (auto byte : index)
       insert_byte(byte);
+    write_fields<Integer_Encoding>(content, insert_byte);
+  }
+
+  //! \brief Copy the packet in an array of bytes
+  //!
+  //! Only available if the length of the packet does not depend on the content. Since C++17, this can be evaluated in
+  //! a constant expression, so that constant packets are stored as byte arrays in read-only memory.
+  UPD_CONSTEXPR17 std::array<byte_t, fixed_length> to_array() const {
+    static_assert(!is_variable_length_tuple<Integer_Encoding, tuple<Endianess, Signed_Mode, Ts...>>::value,
+                  "The length of this packet depends on its content");
+
+    std::array<byte_t, fixed_length> retval{};
+    std::size_t i = 0;
+    for (auto byte : index)
+      retval[i++] = byte;
+    for (auto byte : content)
+      retval[i++] = byte;
+
+    return retval;
   }
 
+  tuple<Endianess, Signed_Mode, Index_T> index;
   tuple<Endianess, Signed_Mode, Ts...> content;
 };
 
@@ -2,6 +2,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
 #include "../format.hpp"
 #include "../upd.hpp"
 #include "type_traits/require.hpp"
@@ -9,72 +13,147 @@
 namespace upd {
 namespace detail {
 
+//! \brief Unsigned integer type holding the serialized representation of `T`
+template<typename T>
+using signed_representation_t = typename std::make_unsigned<T>::type;
+
+//! \brief Mask of the sign bit of a `Width`-bit representation held by `signed_representation_t<T>`
+template<typename T, std::size_t Width = 8 * sizeof(T)>
+constexpr signed_representation_t<T> sign_mask() {
+  return signed_representation_t<T>(signed_representation_t<T>(1) << (Width - 1));
+}
+
+//! \brief Mask of the bits of a `Width`-bit representation held by `signed_representation_t<T>`
+template<typename T, std::size_t Width = 8 * sizeof(T)>
+constexpr signed_representation_t<T> width_mask() {
+  using unsigned_t = signed_representation_t<T>;
+  return unsigned_t(unsigned_t(~unsigned_t(0)) >> (8 * sizeof(T) - Width));
+}
+
 //! \brief Platform-agnostic implementations of `from_signed_mode`
-template<typename T, signed_mode Signed_Mode, detail::require<Signed_Mode == signed_mode::SIGNED_MAGNITUDE> = 0>
-T from_signed_mode_impl(unsigned long long value) {
-  constexpr auto sign_mask = 0b10000000ull << 8 * (sizeof(T) - 1);
-  constexpr auto magnitude_mask = (~0ull >> 8 * (sizeof(value) - sizeof(T))) ^ sign_mask;
-  return value & sign_mask ? T(-T(value & magnitude_mask)) : T(value);
+//!
+//! The representation is `Width` bits wide and the bits above are ignored. The computations are performed in the width
+//! of `T` (or `int` after integer promotion) and never overflow, so they do not depend on the platform signed
+//! representation.
+template<typename T,
+         signed_mode Signed_Mode,
+         std::size_t Width = 8 * sizeof(T),
+         detail::require<Signed_Mode == signed_mode::SIGNED_MAGNITUDE> = 0>
+UPD_CONSTEXPR17 T from_signed_mode_impl(signed_representation_t<T> value) {
+  auto magnitude = signed_representation_t<T>(value & width_mask<T, Width>() & ~sign_mask<T, Width>());
+  return value & sign_mask<T, Width>() ? T(-T(magnitude)) : T(magnitude);
+}
+template<typename T,
+         signed_mode Signed_Mode,
+         std::size_t Width = 8 * sizeof(T),
+         detail::require<Signed_Mode == signed_mode::ONES_COMPLEMENT> = 0>
+UPD_CONSTEXPR17 T from_signed_mode_impl(signed_representation_t<T> value) {
+  return value & sign_mask<T, Width>() ? T(-T(signed_representation_t<T>(~value & width_mask<T, Width>())))
+                                       : T(value & width_mask<T, Width>());
 }
-template<typename T, signed_mode Signed_Mode, detail::require<Signed_Mode == signed_mode::ONES_COMPLEMENT> = 0>
-T from_signed_mode_impl(unsigned long long value) {
-  constexpr auto sign_mask = 0b10000000ull << 8 * (sizeof(T) - 1);
-  return value & sign_mask ? T(-T(~value)) : T(value);
+template<typename T,
+         signed_mode Signed_Mode,
+         std::size_t Width = 8 * sizeof(T),
+         detail::require<Signed_Mode == signed_mode::TWOS_COMPLEMENT && Width == 8 * sizeof(T)> = 0>
+UPD_CONSTEXPR17 T from_signed_mode_impl(signed_representation_t<T> value) {
+  return value & sign_mask<T, Width>() ? T(-T(signed_representation_t<T>(~value)) - 1) : T(value);
 }
-template<typename T, signed_mode Signed_Mode, detail::require<Signed_Mode == signed_mode::TWOS_COMPLEMENT> = 0>
-T from_signed_mode_impl(unsigned long long value) {
-  constexpr auto sign_mask = 0b10000000ull << 8 * (sizeof(T) - 1);
-  return value & sign_mask ? T(-T(~value + 1)) : T(value);
+template<typename T,
+         signed_mode Signed_Mode,
+         std::size_t Width = 8 * sizeof(T),
+         detail::require<Signed_Mode == signed_mode::TWOS_COMPLEMENT && Width != 8 * sizeof(T)> = 0>
+UPD_CONSTEXPR17 T from_signed_mode_impl(signed_representation_t<T> value) {
+  // Flipping the sign bit gives a non-negative value representable by `T`, so the sign extension needs no branch
+  auto flipped = signed_representation_t<T>((value & width_mask<T, Width>()) ^ sign_mask<T, Width>());
+  return T(T(flipped) - T(sign_mask<T, Width>()));
 }
-template<typename T, signed_mode Signed_Mode, detail::require<Signed_Mode == signed_mode::OFFSET_BINARY> = 0>
-T from_signed_mode_impl(unsigned long long value) {
-  constexpr auto offset = 0b10000000ull << 8 * (sizeof(T) - 1);
-  return T(value - offset);
+template<typename T,
+         signed_mode Signed_Mode,
+         std::size_t Width = 8 * sizeof(T),
+         detail::require<Signed_Mode == signed_mode::OFFSET_BINARY> = 0>
+UPD_CONSTEXPR17 T from_signed_mode_impl(signed_representation_t<T> value) {
+  return from_signed_mode_impl<T, signed_mode::TWOS_COMPLEMENT, Width>(
+      signed_representation_t<T>(value ^ sign_mask<T, Width>()));
 }
 
-//! \brief Interpret a sequence of bytes as an integer using the provided signed number representation
-template<typename T, signed_mode Signed_Mode, UPD_REQUIRE(platform_info.signed_mode == Signed_Mode)>
-T from_signed_mode(unsigned long long value) {
-  T retval;
+//! \brief Interpret a `Width`-bit representation as an integer using the provided signed number representation
+template<typename T,
+         signed_mode Signed_Mode,
+         std::size_t Width = 8 * sizeof(T),
+         UPD_REQUIRE(platform_info.signed_mode == Signed_Mode && Width == 8 * sizeof(T))>
+UPD_CONSTEXPR17 T from_signed_mode(signed_representation_t<T> value) {
+  if (UPD_DETAIL_IS_CONSTANT_EVALUATED())
+    return from_signed_mode_impl<T, Signed_Mode>(value);
+
+  T retval{};
   memcpy(&retval, &value, sizeof(retval));
   return retval;
 }
-template<typename T, signed_mode Signed_Mode, UPD_REQUIRE(platform_info.signed_mode != Signed_Mode)>
-T from_signed_mode(unsigned long long value) {
-  return from_signed_mode_impl<T, Signed_Mode>(value);
+template<typename T,
+         signed_mode Signed_Mode,
+         std::size_t Width = 8 * sizeof(T),
+         UPD_REQUIRE(platform_info.signed_mode != Signed_Mode || Width != 8 * sizeof(T))>
+UPD_CONSTEXPR17 T from_signed_mode(signed_representation_t<T> value) {
+  return from_signed_mode_impl<T, Signed_Mode, Width>(value);
 }
 
 //! \brief Platform-agnostic implementations of `to_signed_mode`
-template<signed_mode Signed_Mode, typename T, detail::require<Signed_Mode == signed_mode::SIGNED_MAGNITUDE> = 0>
-unsigned long long to_signed_mode_impl(T value) {
-  constexpr auto sign_mask = 0b10000000ull << 8 * (sizeof(T) - 1);
-  return value >= 0 ? static_cast<unsigned long long>(value) : static_cast<unsigned long long>(-value) | sign_mask;
+//!
+//! Converting a signed integer to an unsigned type is always performed modulo 2^N, which yields the two's complement
+//! representation of the value whatever the platform is. The other representations are derived from it. The result
+//! is truncated to `Width` bits, so `value` must be representable in that width.
+template<signed_mode Signed_Mode,
+         typename T,
+         std::size_t Width = 8 * sizeof(T),
+         detail::require<Signed_Mode == signed_mode::SIGNED_MAGNITUDE> = 0>
+UPD_CONSTEXPR17 signed_representation_t<T> to_signed_mode_impl(T value) {
+  using unsigned_t = signed_representation_t<T>;
+  return value >= 0 ? unsigned_t(value) : unsigned_t(unsigned_t(0u - unsigned_t(value)) | sign_mask<T, Width>());
 }
-template<signed_mode Signed_Mode, typename T, detail::require<Signed_Mode == signed_mode::ONES_COMPLEMENT> = 0>
-unsigned long long to_signed_mode_impl(T value) {
-  return value >= 0 ? static_cast<unsigned long long>(value) : ~static_cast<unsigned long long>(-value);
+template<signed_mode Signed_Mode,
+         typename T,
+         std::size_t Width = 8 * sizeof(T),
+         detail::require<Signed_Mode == signed_mode::ONES_COMPLEMENT> = 0>
+UPD_CONSTEXPR17 signed_representation_t<T> to_signed_mode_impl(T value) {
+  using unsigned_t = signed_representation_t<T>;
+  return value >= 0 ? unsigned_t(value) : unsigned_t((unsigned_t(value) - 1u) & width_mask<T, Width>());
 }
-template<signed_mode Signed_Mode, typename T, detail::require<Signed_Mode == signed_mode::TWOS_COMPLEMENT> = 0>
-unsigned long long to_signed_mode_impl(T value) {
-  return value >= 0 ? static_cast<unsigned long long>(value) : static_cast<unsigned long long>(~(-value - 1));
+template<signed_mode Signed_Mode,
+         typename T,
+         std::size_t Width = 8 * sizeof(T),
+         detail::require<Signed_Mode == signed_mode::TWOS_COMPLEMENT> = 0>
+UPD_CONSTEXPR17 signed_representation_t<T> to_signed_mode_impl(T value) {
+  return signed_representation_t<T>(signed_representation_t<T>(value) & width_mask<T, Width>());
 }
-template<signed_mode Signed_Mode, typename T, detail::require<Signed_Mode == signed_mode::OFFSET_BINARY> = 0>
-unsigned long long to_signed_mode_impl(T value) {
-  constexpr auto offset = 0b10000000ull << 8 * (sizeof(T) - 1);
-  return static_cast<unsigned long long>(value + offset);
+template<signed_mode Signed_Mode,
+         typename T,
+         std::size_t Width = 8 * sizeof(T),
+         detail::require<Signed_Mode == signed_mode::OFFSET_BINARY> = 0>
+UPD_CONSTEXPR17 signed_representation_t<T> to_signed_mode_impl(T value) {
+  using unsigned_t = signed_representation_t<T>;
+  return unsigned_t((unsigned_t(value) ^ sign_mask<T, Width>()) & width_mask<T, Width>());
 }
 
-//! \brief Serialize an integer using the provided signed number representation
-template<signed_mode Signed_Mode, typename T, UPD_REQUIRE(platform_info.signed_mode == Signed_Mode)>
-unsigned long long to_signed_mode(T value) {
-  unsigned long long retval;
+//! \brief Serialize an integer into a `Width`-bit representation using the provided signed number representation
+template<signed_mode Signed_Mode,
+         typename T,
+         std::size_t Width = 8 * sizeof(T),
+         UPD_REQUIRE(platform_info.signed_mode == Signed_Mode && Width == 8 * sizeof(T))>
+UPD_CONSTEXPR17 signed_representation_t<T> to_signed_mode(T value) {
+  if (UPD_DETAIL_IS_CONSTANT_EVALUATED())
+    return to_signed_mode_impl<Signed_Mode, T>(value);
+
+  signed_representation_t<T> retval{};
   memcpy(&retval, &value, sizeof value);
 
   return retval;
 }
-template<signed_mode Signed_Mode, typename T, UPD_REQUIRE(platform_info.signed_mode != Signed_Mode)>
-unsigned long long to_signed_mode(T value) {
-  return to_signed_mode_impl<Signed_Mode, T>(value);
+template<signed_mode Signed_Mode,
+         typename T,
+         std::size_t Width = 8 * sizeof(T),
+         UPD_REQUIRE(platform_info.signed_mode != Signed_Mode || Width != 8 * sizeof(T))>
+UPD_CONSTEXPR17 signed_representation_t<T> to_signed_mode(T value) {
+  return to_signed_mode_impl<Signed_Mode, T, Width>(value);
 }
 
 } // namespace detail
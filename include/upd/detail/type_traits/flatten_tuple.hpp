@@ -2,8 +2,12 @@
 
 #pragma once
 
+#include <tuple>
+#include <utility>
+
 #include "../../format.hpp"
 #include "../../tuple.hpp"
+#include "remove_cv_ref.hpp"
 
 namespace upd {
 namespace detail {
@@ -12,9 +16,10 @@ namespace detail {
 //! \brief Flatten a tuple type if needed
 //!
 //! If `Ts` expands to a single type, and that type can be expressed as `tuple<...>`, then `flatten_tuple_t<Ts...>`
-//! is an alias of `Ts...`. If `Ts...` expands into `void`, then `flatten_tuple_t<Ts...>` is an alias of
-//! tuple<Endianess, Signed_Mode>. Otherwise, type `flatten_tuple_t<Ts...>` is an alias of `tuple<Endianess,
-//! Signed_Mode, Ts...>`.
+//! is an alias of `Ts...`. If `Ts...` expands into `std::tuple<Us...>` or `std::pair<Us...>`, then
+//! `flatten_tuple_t<Ts...>` is an alias of `tuple<Endianess, Signed_Mode, Us...>`. If `Ts...` expands into `void`,
+//! then `flatten_tuple_t<Ts...>` is an alias of tuple<Endianess, Signed_Mode>. Otherwise, type `flatten_tuple_t<Ts...>`
+//! is an alias of `tuple<Endianess, Signed_Mode, Ts...>`.
 //! @{
 
 template<endianess Endianess, signed_mode Signed_Mode, typename... Ts>
@@ -29,6 +34,14 @@ template<endianess Endianess,
 struct flatten_tuple<Endianess, Signed_Mode, tuple<Endianess_Tuple, Signed_Mode_Tuple, Ts...>> {
   using type = tuple<Endianess_Tuple, Signed_Mode_Tuple, Ts...>;
 };
+template<endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+struct flatten_tuple<Endianess, Signed_Mode, std::tuple<Ts...>> {
+  using type = tuple<Endianess, Signed_Mode, remove_cv_ref_t<Ts>...>;
+};
+template<endianess Endianess, signed_mode Signed_Mode, typename T, typename U>
+struct flatten_tuple<Endianess, Signed_Mode, std::pair<T, U>> {
+  using type = tuple<Endianess, Signed_Mode, remove_cv_ref_t<T>, remove_cv_ref_t<U>>;
+};
 template<endianess Endianess, signed_mode Signed_Mode>
 struct flatten_tuple<Endianess, Signed_Mode, void> {
   using type = tuple<Endianess, Signed_Mode>;
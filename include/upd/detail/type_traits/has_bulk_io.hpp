@@ -0,0 +1,37 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits> // IWYU pragma: keep
+#include <utility>
+
+#include "../../type.hpp"
+#include "../../upd.hpp"
+#include "detector.hpp"
+
+namespace upd {
+namespace detail {
+
+UPD_DETAIL_MAKE_DETECTOR(has_bulk_read_impl,
+                         UPD_PACK(typename Src),
+                         UPD_PACK(typename = decltype(std::declval<Src &>().read(std::declval<byte_t *>(),
+                                                                                 std::size_t{}))))
+
+UPD_DETAIL_MAKE_DETECTOR(has_bulk_write_impl,
+                         UPD_PACK(typename Dest),
+                         UPD_PACK(typename = decltype(std::declval<Dest &>().write(std::declval<const byte_t *>(),
+                                                                                   std::size_t{}))))
+
+//! \brief Indicates whether the byte getter of type `Src` can also read several bytes at once through a
+//! `read(byte_t *, std::size_t)` member function
+template<typename Src>
+struct has_bulk_read : decltype(has_bulk_read_impl<Src>(0)) {};
+
+//! \brief Indicates whether the byte putter of type `Dest` can also write several bytes at once through a
+//! `write(const byte_t *, std::size_t)` member function
+template<typename Dest>
+struct has_bulk_write : decltype(has_bulk_write_impl<Dest>(0)) {};
+
+} // namespace detail
+} // namespace upd
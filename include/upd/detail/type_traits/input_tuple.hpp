@@ -16,11 +16,18 @@ struct input_tuple_impl;
 template<typename R, typename... Args, endianess Endianess, signed_mode Signed_Mode>
 struct input_tuple_impl<R(Args...), Endianess, Signed_Mode> {
   using type = tuple<Endianess, Signed_Mode, remove_cv_ref_t<Args>...>;
+
+  template<typename It>
+  using view_t = tuple_view<It, Endianess, Signed_Mode, remove_cv_ref_t<Args>...>;
 };
 
 //! \brief Template instance of `tuple` suitable for holding the parameters of an invocable of type `F`
 template<endianess Endianess, signed_mode Signed_Mode, typename F>
 using input_tuple = typename input_tuple_impl<signature_t<F>, Endianess, Signed_Mode>::type;
 
+//! \brief Template instance of `tuple_view` suitable for viewing the parameters of an invocable of type `F`
+template<typename It, endianess Endianess, signed_mode Signed_Mode, typename F>
+using input_tuple_view = typename input_tuple_impl<signature_t<F>, Endianess, Signed_Mode>::template view_t<It>;
+
 } // namespace detail
 } // namespace upd
@@ -0,0 +1,32 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace upd {
+
+template<typename T, std::size_t N>
+class bounded_vector;
+
+template<std::size_t N>
+class bounded_string;
+
+namespace detail {
+
+//! \name
+//! \brief Check if `T` is a \ref<bounded_vector> bounded_vector or a \ref<bounded_string> bounded_string instance
+//! @{
+
+template<typename T>
+struct is_bounded : std::false_type {};
+template<typename T, std::size_t N>
+struct is_bounded<bounded_vector<T, N>> : std::true_type {};
+template<std::size_t N>
+struct is_bounded<bounded_string<N>> : std::true_type {};
+
+//! @}
+
+} // namespace detail
+} // namespace upd
@@ -0,0 +1,28 @@
+//! \file
+
+#pragma once
+
+#include <type_traits>
+
+namespace upd {
+
+class float16;
+class bfloat16;
+
+namespace detail {
+
+//! \name
+//! \brief Check if `T` is \ref<float16> float16 or \ref<bfloat16> bfloat16
+//! @{
+
+template<typename T>
+struct is_half_precision : std::false_type {};
+template<>
+struct is_half_precision<float16> : std::true_type {};
+template<>
+struct is_half_precision<bfloat16> : std::true_type {};
+
+//! @}
+
+} // namespace detail
+} // namespace upd
@@ -0,0 +1,30 @@
+//! \file
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace upd {
+namespace detail {
+
+//! \brief Check if `T` is a floating-point type represented in the IEEE 754 binary32 or binary64 format
+//!
+//! Such values are serialized as their representation in this format, as if it were an unsigned integer of the same
+//! size. Therefore, their byte order follows the serialization endianess.
+template<typename T, bool = std::is_floating_point<T>::value>
+struct is_ieee754 : std::false_type {};
+template<typename T>
+struct is_ieee754<T, true>
+    : std::integral_constant<bool,
+                             std::numeric_limits<T>::is_iec559 &&
+                                 (sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t))> {};
+
+//! \brief Unsigned integer type used to serialize an IEEE 754 floating-point type
+template<typename T>
+using ieee754_representation_t =
+    typename std::conditional<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>::type;
+
+} // namespace detail
+} // namespace upd
@@ -0,0 +1,44 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace upd {
+
+template<std::size_t>
+class uint_n;
+template<std::size_t>
+class int_n;
+
+namespace detail {
+
+//! \name
+//! \brief Check if `T` is a \ref<uint_n> uint_n instance
+//! @{
+
+template<typename T>
+struct is_unsigned_int_n : std::false_type {};
+template<std::size_t Bits>
+struct is_unsigned_int_n<uint_n<Bits>> : std::true_type {};
+
+//! @}
+
+//! \name
+//! \brief Check if `T` is an \ref<int_n> int_n instance
+//! @{
+
+template<typename T>
+struct is_signed_int_n : std::false_type {};
+template<std::size_t Bits>
+struct is_signed_int_n<int_n<Bits>> : std::true_type {};
+
+//! @}
+
+//! \brief Check if `T` is a \ref<uint_n> uint_n or an \ref<int_n> int_n instance
+template<typename T>
+struct is_int_n : std::integral_constant<bool, is_unsigned_int_n<T>::value || is_signed_int_n<T>::value> {};
+
+} // namespace detail
+} // namespace upd
@@ -0,0 +1,21 @@
+//! \file
+
+#pragma once
+
+#include <type_traits>
+
+#include "is_half_precision.hpp"
+#include "is_scaled.hpp"
+
+namespace upd {
+namespace detail {
+
+//! \brief Check if `T` only holds an integer representation, available through its `raw()` and `from_raw()` members
+//!
+//! Such types are \ref<scaled> scaled, \ref<float16> float16 and \ref<bfloat16> bfloat16. They are serialized as
+//! their integer representation.
+template<typename T>
+struct is_integer_represented : std::integral_constant<bool, is_scaled<T>::value || is_half_precision<T>::value> {};
+
+} // namespace detail
+} // namespace upd
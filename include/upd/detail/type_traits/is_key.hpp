@@ -8,7 +8,7 @@
 
 namespace upd {
 
-template<typename Index_T, Index_T, typename, endianess, signed_mode>
+template<typename Index_T, Index_T, typename, endianess, signed_mode, integer_encoding = integer_encoding::FIXED_WIDTH>
 class key;
 
 namespace detail {
@@ -18,8 +18,14 @@ namespace detail {
 
 template<typename T>
 struct is_key : std::false_type {};
-template<typename Index_T, Index_T I, typename R, typename... Args, endianess Endianess, signed_mode Signed_Mode>
-struct is_key<key<Index_T, I, R(Args...), Endianess, Signed_Mode>> : std::true_type {};
+template<typename Index_T,
+         Index_T I,
+         typename R,
+         typename... Args,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding>
+struct is_key<key<Index_T, I, R(Args...), Endianess, Signed_Mode, Integer_Encoding>> : std::true_type {};
 
 //! @^}
 
@@ -18,6 +18,9 @@ namespace detail {
 
 template<endianess Endianess, signed_mode Signed_Mode, typename... Fs, Fs... Ftors>
 std::true_type is_keyring_impl(keyring<Endianess, Signed_Mode, unevaluated<Fs, Ftors>...>);
+template<endianess Endianess, signed_mode Signed_Mode, integer_encoding Integer_Encoding, typename... Fs, Fs... Ftors>
+std::true_type
+    is_keyring_impl(keyring<Endianess, Signed_Mode, integer_encoding_h<Integer_Encoding>, unevaluated<Fs, Ftors>...>);
 std::false_type is_keyring_impl(...);
 
 //! \brief Check if `T` is a valid keyring
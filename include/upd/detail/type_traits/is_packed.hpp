@@ -0,0 +1,26 @@
+//! \file
+
+#pragma once
+
+#include <type_traits>
+
+namespace upd {
+
+template<typename...>
+class packed;
+
+namespace detail {
+
+//! \name
+//! \brief Check if `T` is a \ref<packed> packed instance
+//! @{
+
+template<typename T>
+struct is_packed : std::false_type {};
+template<typename... Ts>
+struct is_packed<packed<Ts...>> : std::true_type {};
+
+//! @}
+
+} // namespace detail
+} // namespace upd
@@ -0,0 +1,26 @@
+//! \file
+
+#pragma once
+
+#include <type_traits>
+
+namespace upd {
+
+template<typename, typename, typename>
+class scaled;
+
+namespace detail {
+
+//! \name
+//! \brief Check if `T` is a \ref<scaled> scaled instance
+//! @{
+
+template<typename T>
+struct is_scaled : std::false_type {};
+template<typename Int_T, typename Scale, typename Offset>
+struct is_scaled<scaled<Int_T, Scale, Offset>> : std::true_type {};
+
+//! @}
+
+} // namespace detail
+} // namespace upd
@@ -0,0 +1,18 @@
+//! \file
+
+#pragma once
+
+#include <type_traits>
+
+namespace upd {
+
+class segmented_iterator;
+
+namespace detail {
+
+//! \brief Check if `T` is a \ref<segmented_iterator> segmented_iterator
+template<typename T>
+struct is_segmented_iterator : std::is_same<T, segmented_iterator> {};
+
+} // namespace detail
+} // namespace upd
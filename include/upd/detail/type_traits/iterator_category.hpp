@@ -2,8 +2,16 @@
 
 #pragma once
 
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include "../../upd.hpp"
 #include "detector.hpp"
+#include "remove_cv_ref.hpp"
 #include "require.hpp"
 
 namespace upd {
@@ -24,5 +32,135 @@ struct is_input_byte_iterator : decltype(is_input_byte_iterator_impl<T>(0)) {};
 template<typename T>
 struct is_output_byte_iterator : decltype(is_output_byte_iterator_impl<T>(0)) {};
 
+//! \brief Check if `T` is either a byte putter or an output byte iterator
+template<typename T>
+struct is_byte_output : std::integral_constant<bool,
+                                               has_signature<T, void(byte_t)>::value ||
+                                                   is_output_byte_iterator<decay_t<T>>::value> {};
+
+//! \brief Check if `T` is a character type, whose objects may be accessed as bytes
+template<typename T>
+struct is_byte_alias : std::integral_constant<bool,
+                                              std::is_same<T, char>::value || std::is_same<T, signed char>::value ||
+                                                  std::is_same<T, unsigned char>::value> {};
+
+//! \brief Check if `It` is an iterator of a standard container of `V` which stores its elements contiguously
+template<typename It, typename V>
+struct is_standard_contiguous_iterator
+    : std::integral_constant<bool,
+                             std::is_same<It, typename std::vector<V>::iterator>::value ||
+                                 std::is_same<It, typename std::vector<V>::const_iterator>::value> {};
+template<typename It>
+struct is_standard_contiguous_iterator<It, char>
+    : std::integral_constant<bool,
+                             std::is_same<It, typename std::vector<char>::iterator>::value ||
+                                 std::is_same<It, typename std::vector<char>::const_iterator>::value ||
+                                 std::is_same<It, typename std::string::iterator>::value ||
+                                 std::is_same<It, typename std::string::const_iterator>::value> {};
+
+#if __cplusplus >= 202002L && defined(__cpp_lib_concepts)
+template<typename It, bool = std::contiguous_iterator<It>>
+struct is_contiguous_byte_iterator_impl : std::false_type {};
+template<typename It>
+struct is_contiguous_byte_iterator_impl<It, true> : is_byte_alias<std::remove_cv_t<std::iter_value_t<It>>> {};
+#else  // __cplusplus >= 202002L && defined(__cpp_lib_concepts)
+template<typename It, bool = std::is_pointer<It>::value>
+struct is_contiguous_byte_iterator_impl
+    : std::integral_constant<bool,
+                             is_standard_contiguous_iterator<It, char>::value ||
+                                 is_standard_contiguous_iterator<It, signed char>::value ||
+                                 is_standard_contiguous_iterator<It, unsigned char>::value> {};
+template<typename It>
+struct is_contiguous_byte_iterator_impl<It, true>
+    : is_byte_alias<typename std::remove_cv<typename std::remove_pointer<It>::type>::type> {};
+#endif // __cplusplus >= 202002L && defined(__cpp_lib_concepts)
+
+//! \brief Check if `It` is an iterator to a contiguous sequence of bytes
+//!
+//! Such iterators can be converted to a plain pointer with `to_byte_pointer`, so that the byte sequence can be accessed
+//! with `memcpy`. Before C++20, only pointers and the iterators of `std::vector` and `std::string` instances of
+//! character types are detected.
+template<typename It>
+struct is_contiguous_byte_iterator : is_contiguous_byte_iterator_impl<remove_cv_ref_t<It>> {};
+
+//! \brief Type of the iterators of a range of type `Range`
+template<typename Range>
+using range_iterator_t = decltype(std::begin(std::declval<Range &>()));
+
+UPD_DETAIL_MAKE_DETECTOR(is_contiguous_byte_range_impl,
+                         UPD_PACK(typename Range),
+                         UPD_PACK(require<is_contiguous_byte_iterator<range_iterator_t<Range>>::value> = 0))
+
+//! \brief Check if `Range` is a range (such as a container or a plain array) whose iterators are contiguous byte
+//! iterators
+template<typename Range>
+struct is_contiguous_byte_range : decltype(is_contiguous_byte_range_impl<Range>(0)) {};
+
+//! \name
+//! \brief Get a pointer to the byte designated by a contiguous byte iterator
+//!
+//! Before C++20, the iterator must be dereferenceable.
+//! @{
+
+template<typename It,
+         UPD_REQUIRE(!std::is_const<typename std::remove_reference<decltype(*std::declval<It>())>::type>::value)>
+byte_t *to_byte_pointer(const It &it) {
+#if __cplusplus >= 202002L && defined(__cpp_lib_to_address)
+  return reinterpret_cast<byte_t *>(std::to_address(it));
+#else  // __cplusplus >= 202002L && defined(__cpp_lib_to_address)
+  return reinterpret_cast<byte_t *>(&*it);
+#endif // __cplusplus >= 202002L && defined(__cpp_lib_to_address)
+}
+template<typename It,
+         UPD_REQUIRE(std::is_const<typename std::remove_reference<decltype(*std::declval<It>())>::type>::value)>
+const byte_t *to_byte_pointer(const It &it) {
+#if __cplusplus >= 202002L && defined(__cpp_lib_to_address)
+  return reinterpret_cast<const byte_t *>(std::to_address(it));
+#else  // __cplusplus >= 202002L && defined(__cpp_lib_to_address)
+  return reinterpret_cast<const byte_t *>(&*it);
+#endif // __cplusplus >= 202002L && defined(__cpp_lib_to_address)
+}
+
+//! @}
+
+//! \name
+//! \brief Get a pointer to the first byte of a contiguous range of bytes (see `is_contiguous_byte_range`) and its size
+//!
+//! Unlike `to_byte_pointer`, `range_data` may be called on empty ranges, in which case it returns a null pointer.
+//! @{
+
+template<typename Range>
+auto range_data(Range &range) -> decltype(to_byte_pointer(std::begin(range))) {
+  return std::begin(range) != std::end(range) ? to_byte_pointer(std::begin(range)) : nullptr;
+}
+template<typename Range>
+std::size_t range_size(Range &range) {
+  return std::size_t(std::distance(std::begin(range), std::end(range)));
+}
+
+//! @}
+
+//! \name
+//! \brief Replace a contiguous byte iterator with a plain pointer if it can be done for any valid iterator
+//!
+//! This is only possible with C++20 `std::to_address`, which does not dereference the iterator. Otherwise, the iterator
+//! is returned unchanged.
+//! @{
+
+#if __cplusplus >= 202002L && defined(__cpp_lib_to_address)
+template<typename It, UPD_REQUIRE(is_contiguous_byte_iterator<It>::value)>
+auto unwrap_byte_iterator(const It &it) -> decltype(to_byte_pointer(it)) {
+  return to_byte_pointer(it);
+}
+template<typename It, UPD_REQUIRE(!is_contiguous_byte_iterator<It>::value)>
+#else  // __cplusplus >= 202002L && defined(__cpp_lib_to_address)
+template<typename It>
+#endif // __cplusplus >= 202002L && defined(__cpp_lib_to_address)
+const It &unwrap_byte_iterator(const It &it) {
+  return it;
+}
+
+//! @}
+
 } // namespace detail
 } // namespace upd
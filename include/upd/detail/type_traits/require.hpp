@@ -8,8 +8,14 @@
 #include "../../format.hpp"
 #include "../../type.hpp"
 #include "is_array.hpp"
+#include "is_bounded.hpp"
+#include "is_ieee754.hpp"
+#include "is_int_n.hpp"
+#include "is_integer_represented.hpp"
 #include "is_key.hpp"
 #include "is_keyring.hpp"
+#include "is_packed.hpp"
+#include "is_segmented_iterator.hpp"
 #include "is_tuple.hpp"
 #include "is_user_serializable.hpp"
 #include "signature.hpp"
@@ -100,7 +106,37 @@ using require_unsigned_integer = require<std::is_unsigned<T>::value, U>;
 
 //! \brief Require the provided type to be a signed integer type
 template<typename T, typename U = int>
-using require_signed_integer = require<std::is_signed<T>::value, U>;
+using require_signed_integer = require<std::is_signed<T>::value && std::is_integral<T>::value, U>;
+
+//! \brief Require the provided type to be a floating-point type represented in the IEEE 754 binary32 or binary64 format
+template<typename T, typename U = int>
+using require_ieee754 = require<is_ieee754<T>::value, U>;
+
+//! \brief Require the provided type to be a \ref<bounded_vector> bounded_vector or a \ref<bounded_string>
+//! bounded_string instance
+template<typename T, typename U = int>
+using require_bounded = require<is_bounded<T>::value, U>;
+
+//! \brief Require the provided type to be a \ref<packed> packed instance
+template<typename T, typename U = int>
+using require_packed = require<is_packed<T>::value, U>;
+
+//! \brief Require the provided type to be a \ref<uint_n> uint_n instance
+template<typename T, typename U = int>
+using require_unsigned_int_n = require<is_unsigned_int_n<T>::value, U>;
+
+//! \brief Require the provided type to be an \ref<int_n> int_n instance
+template<typename T, typename U = int>
+using require_signed_int_n = require<is_signed_int_n<T>::value, U>;
+
+//! \brief Require the provided type to be serialized as its integer representation (i.e. a \ref<scaled> scaled,
+//! \ref<float16> float16 or \ref<bfloat16> bfloat16 instance)
+template<typename T, typename U = int>
+using require_integer_represented = require<is_integer_represented<T>::value, U>;
+
+//! \brief Require the provided type to be a \ref<segmented_iterator> segmented_iterator
+template<typename T, typename U = int>
+using require_segmented_iterator = require<is_segmented_iterator<T>::value, U>;
 
 //! \brief Require the provided type to be an bounded array type
 template<typename T, typename U = int>
@@ -0,0 +1,117 @@
+//! \file
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "../type.hpp"
+#include "../upd.hpp"
+#include "type_traits/require.hpp"
+
+namespace upd {
+namespace detail {
+
+//! \brief Check if values of type `T` are written as varints when `integer_encoding::VARINT` is selected
+//!
+//! Booleans and one-byte integers (including characters) are left out since their varint would never be shorter.
+template<typename T>
+struct is_varint_integer : std::integral_constant<bool, std::is_integral<T>::value && sizeof(T) != 1> {};
+
+//! \name
+//! \brief Describe a field as a sequence of `value` consecutive instances of `element_t`
+//! @{
+
+template<typename T>
+struct varint_field : std::integral_constant<std::size_t, 1> {
+  using element_t = T;
+};
+template<typename T, std::size_t N>
+struct varint_field<T[N]> : std::integral_constant<std::size_t, N> {
+  using element_t = T;
+};
+template<typename T, std::size_t N>
+struct varint_field<std::array<T, N>> : std::integral_constant<std::size_t, N> {
+  using element_t = T;
+};
+
+//! @}
+
+//! \brief Maximum number of bytes of the LEB128 encoding of an integer of type `T`
+template<typename T>
+struct varint_max_size : std::integral_constant<std::size_t, (8 * sizeof(T) + 6) / 7> {};
+
+//! \name
+//! \brief Map signed integers to unsigned integers so that values of small magnitude have small representations
+//!
+//! The values 0, -1, 1, -2, 2, ... are respectively mapped to 0, 1, 2, 3, 4, ... Unsigned integers are left untouched.
+//! @{
+
+template<typename T, require_unsigned_integer<T> = 0>
+constexpr T to_zigzag(T value) {
+  return value;
+}
+template<typename T, require_signed_integer<T> = 0>
+UPD_CONSTEXPR17 typename std::make_unsigned<T>::type to_zigzag(T value) {
+  using unsigned_t = typename std::make_unsigned<T>::type;
+  return unsigned_t(unsigned_t(unsigned_t(value) << 1) ^ (value < 0 ? unsigned_t(~unsigned_t(0)) : unsigned_t(0)));
+}
+
+//! @}
+
+//! \name
+//! \brief Inverse of `to_zigzag`
+//! @{
+
+template<typename T, require_unsigned_integer<T> = 0>
+T from_zigzag(T value) {
+  return value;
+}
+template<typename T, require_signed_integer<T> = 0>
+T from_zigzag(typename std::make_unsigned<T>::type value) {
+  using unsigned_t = typename std::make_unsigned<T>::type;
+  return value & 1u ? T(-T(unsigned_t(value >> 1)) - 1) : T(unsigned_t(value >> 1));
+}
+
+//! @}
+
+//! \brief Write an unsigned integer as a LEB128 varint (seven bits per byte, least significant group first)
+template<typename T, typename Dest>
+UPD_CONSTEXPR17 void write_varint(T value, Dest &dest) {
+  for (; value >= 0x80u; value = T(value >> 7))
+    dest(byte_t((value & 0x7fu) | 0x80u));
+  dest(byte_t(value));
+}
+
+//! \brief Read an unsigned integer written as a LEB128 varint
+//!
+//! At most `varint_max_size<T>::value` bytes are read, whatever the continuation bit of the last one is. The bits which
+//! do not fit in `T` are discarded.
+template<typename T, typename Src>
+T read_varint(Src &src) {
+  auto value = T(0);
+  for (std::size_t i = 0; i < varint_max_size<T>::value; i++) {
+    auto byte = byte_t(src());
+    value = T(value | T(T(byte & 0x7fu) << 7 * i));
+    if (!(byte & 0x80u))
+      break;
+  }
+
+  return value;
+}
+
+//! \brief Offset of the end of the varint starting at `offset` in the `size` first bytes of `payload`
+//!
+//! If the varint is not complete, the returned offset assumes that the next byte to be received will end it.
+template<typename T>
+std::size_t skip_varint(const byte_t *payload, std::size_t size, std::size_t offset) {
+  auto last = offset + varint_max_size<T>::value - 1;
+  while (offset < size && offset < last && payload[offset] & 0x80u)
+    offset++;
+
+  return offset + 1;
+}
+
+} // namespace detail
+} // namespace upd
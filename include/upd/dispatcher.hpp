@@ -2,11 +2,15 @@
 
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
 
 #include "action.hpp"
+#include "detail/encoding.hpp"
+#include "detail/io/byte_stream.hpp"
 #include "detail/io/immediate_process.hpp"
 #include "detail/static_error.hpp"
+#include "detail/type_traits/iterator_category.hpp"
 #include "detail/type_traits/is_keyring.hpp"
 #include "detail/type_traits/require.hpp"
 #include "detail/type_traits/signature.hpp"
@@ -32,9 +36,13 @@ template<action_features Action_Features,
          F Ftor,
          endianess Endianess,
          signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
          UPD_REQUIRE(Action_Features == action_features::WEAK_REFERENCE)>
 no_storage_action make_action() {
-  return no_storage_action{unevaluated<F, Ftor>{}, endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}};
+  return no_storage_action{unevaluated<F, Ftor>{},
+                           endianess_h<Endianess>{},
+                           signed_mode_h<Signed_Mode>{},
+                           integer_encoding_h<Integer_Encoding>{}};
 }
 
 template<action_features Action_Features,
@@ -42,31 +50,56 @@ template<action_features Action_Features,
          F Ftor,
          endianess Endianess,
          signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
          UPD_REQUIRE(Action_Features == action_features::ANY)>
 action make_action() {
-  return action{Ftor, endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}};
+  return action{Ftor, endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, integer_encoding_h<Integer_Encoding>{}};
 }
 
 //! @}
 
 //! \brief Alias for `action` if `Action_Features` is `action_features::ANY`, `no_storage_action` otherwise
 template<action_features Action_Features>
-using action_t = decltype(make_action<Action_Features, int, 0, endianess::LITTLE, signed_mode::TWOS_COMPLEMENT>());
+using action_t = decltype(make_action<Action_Features,
+                                      int,
+                                      0,
+                                      endianess::LITTLE,
+                                      signed_mode::TWOS_COMPLEMENT,
+                                      integer_encoding::FIXED_WIDTH>());
 
 //! \brief Stores actions
 //!
 //! This class template helps with initializing the storage with a typelist
 template<typename Index_T, Index_T Size, action_features Action_Features>
 struct actions {
-  template<typename... Fs, Fs... Ftors, endianess Endianess, signed_mode Signed_Mode>
-  actions(flist_t<unevaluated<Fs, Ftors>...>, endianess_h<Endianess>, signed_mode_h<Signed_Mode>)
-      : content{make_action<Action_Features, Fs, Ftors, Endianess, Signed_Mode>()...} {}
+  template<typename... Fs,
+           Fs... Ftors,
+           endianess Endianess,
+           signed_mode Signed_Mode,
+           integer_encoding Integer_Encoding>
+  actions(flist_t<unevaluated<Fs, Ftors>...>,
+          endianess_h<Endianess>,
+          signed_mode_h<Signed_Mode>,
+          integer_encoding_h<Integer_Encoding>)
+      : content{make_action<Action_Features, Fs, Ftors, Endianess, Signed_Mode, Integer_Encoding>()...} {}
 
   action_t<Action_Features> content[Size];
 };
 
 } // namespace detail
 
+//! \brief Outcome of processing a batch of action requests stored back to back
+struct batch_result {
+  //! \brief Number of action requests processed
+  std::size_t packet_count;
+
+  //! \brief Number of bytes taken from the input
+  std::size_t consumed;
+
+  //! \brief Number of bytes written to the output
+  std::size_t produced;
+};
+
 //! \brief Action container able to accept and process action requests
 //!
 //! A dispatcher is constructed from a \ref<keyring> keyring instance and is able to unserialize a payload serialized by
@@ -101,11 +134,19 @@ public:
   //!  \copydoc keyring::signed_mode
   constexpr static auto signed_mode = Keyring::signed_mode;
 
+  //! \copydoc keyring::integer_encoding
+  constexpr static auto integer_encoding = Keyring::integer_encoding;
+
   //! \brief Construct the object from the provided keyring
   explicit dispatcher(Keyring, action_features_h<Action_Features>) : dispatcher{} {}
 
   //! \copybrief dispatcher::dispatcher
-  dispatcher() : m_actions{typename Keyring::flist_t{}, endianess_h<endianess>{}, signed_mode_h<signed_mode>{}} {}
+  dispatcher()
+      : m_actions{typename Keyring::flist_t{},
+                  endianess_h<endianess>{},
+                  signed_mode_h<signed_mode>{},
+                  integer_encoding_h<integer_encoding>{}} {}
+
   using detail::immediate_process<dispatcher<Keyring, Action_Features>, index_t>::operator();
 
   //! \brief Extract an index from a byte sequence then invoke the action with that index
@@ -126,6 +167,65 @@ public:
     return index;
   }
 
+  //! \brief Process action requests stored back to back and write their responses back to back
+  //!
+  //! The length of each request is known from its index (or from its content if it depends on it, as for the actions
+  //! made by `make_delta_action()`), so the requests
+  //! are processed straight from `input` and the responses are written straight to `output`, each of them with a
+  //! single copy. Processing stops at the end of the input or before the first request which:
+  //!   - has an invalid index,
+  //!   - is not complete,
+  //!   - may have a response too long for the remaining space in `output`.
+  //!
+  //! \param input Beginning of the requests
+  //! \param input_size Number of bytes in `input`
+  //! \param output Beginning of the storage for the responses
+  //! \param output_size Number of bytes available in `output`
+  //! \return a \ref<batch_result> batch_result instance
+  batch_result process_batch(const byte_t *input, std::size_t input_size, byte_t *output, std::size_t output_size) {
+    batch_result result{0, 0, 0};
+
+    while (input_size - result.consumed >= sizeof(index_t)) {
+      detail::iterator_reader<const byte_t *> src{input + result.consumed};
+      auto index = get_index(src);
+      if (!(index < size))
+        break;
+
+      auto available = input_size - result.consumed - sizeof(index_t);
+      using signatures_tlist_t = typename signatures_t::type;
+      auto length = detail::action_request_length<integer_encoding, endianess, signed_mode, signatures_tlist_t>(
+          m_actions.content[index], index, src.it, available);
+      if (length > available || sizes_t::response(index) > output_size - result.produced)
+        break;
+
+      detail::iterator_writer<byte_t *> dest{output + result.produced};
+      m_actions.content[index].call_in_place(src.it, dest);
+
+      result.packet_count++;
+      result.consumed += sizeof(index_t) + length;
+      result.produced = std::size_t(dest.it - output);
+    }
+
+    return result;
+  }
+
+  //! \brief Process action requests stored back to back in a contiguous range of bytes and write their responses
+  //! back to back into another one
+  //!
+  //! This function behaves as `process_batch(const byte_t *, std::size_t, byte_t *, std::size_t)`.
+  //!
+  //! \param input Range holding the requests (such as a `std::vector` or `std::span` instance)
+  //! \param output Range to write the responses into
+  //! \return a \ref<batch_result> batch_result instance
+  template<typename Input,
+           typename Output,
+           UPD_REQUIRE(detail::is_contiguous_byte_range<const Input>::value &&
+                       detail::is_contiguous_byte_range<Output>::value)>
+  batch_result process_batch(const Input &input, Output &&output) {
+    return process_batch(
+        detail::range_data(input), detail::range_size(input), detail::range_data(output), detail::range_size(output));
+  }
+
   //! \brief Extract an index from a byte sequence and get the action with that index
   //! \param src Byte getter
   //! \return Either a reference to the action if it exists or `nullptr`
@@ -140,7 +240,7 @@ public:
   //! \return The extracted index
   template<typename Src, UPD_REQUIREMENT(input_invocable, Src)>
   index_t get_index(Src &&src) const {
-    tuple<endianess, signed_mode, index_t> index_tuple;
+    tuple<endianess, signed_mode, index_t> index_tuple{uninitialized};
 
     for (auto &byte : index_tuple)
       byte = src();
@@ -157,7 +257,8 @@ public:
     static_assert(std::is_same<detail::at<signatures_t, Index>, detail::signature_t<F>>::value,
                   UPD_ERROR_SIGNATURE_MISMATCH(Ftor));
 
-    m_actions.content[Index] = detail::make_action<Action_Features, F, Ftor, endianess, signed_mode>();
+    m_actions.content[Index] =
+        detail::make_action<Action_Features, F, Ftor, endianess, signed_mode, integer_encoding>();
   }
 
 #if __cplusplus >= 201703L
@@ -183,7 +284,10 @@ public:
     static_assert(std::is_same<detail::at<signatures_t, Index>, detail::signature_t<F>>::value,
                   UPD_ERROR_SIGNATURE_MISMATCH(ftor));
 
-    m_actions.content[Index] = action{UPD_FWD(ftor), endianess_h<endianess>{}, signed_mode_h<signed_mode>{}};
+    m_actions.content[Index] = action{UPD_FWD(ftor),
+                                      endianess_h<endianess>{},
+                                      signed_mode_h<signed_mode>{},
+                                      integer_encoding_h<integer_encoding>{}};
   }
 
   //! \brief Get one of the stored actions
@@ -196,6 +300,8 @@ public:
   const action_t &operator[](index_t index) const { return m_actions.content[index]; }
 
 private:
+  using sizes_t = detail::payload_size_table<integer_encoding, typename signatures_t::type>;
+
   detail::actions<index_t, size, Action_Features> m_actions;
 };
 
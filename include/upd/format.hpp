@@ -12,6 +12,12 @@ enum class endianess { LITTLE, BIG };
 //! \brief Used to specify signed integer representation for serialization and unserialization
 enum class signed_mode { SIGNED_MAGNITUDE, ONES_COMPLEMENT, TWOS_COMPLEMENT, OFFSET_BINARY };
 
+//! \brief Used to specify how integers are laid out in action requests and responses
+//!
+//! - `FIXED_WIDTH`: Integers occupy as many bytes as their type does
+//! - `VARINT`: Integers wider than one byte are written as LEB128 varints, after a zigzag encoding for signed types
+enum class integer_encoding { FIXED_WIDTH, VARINT };
+
 //! \brief \ref<endianess> endianess enumerator holder for named parameters
 template<endianess Endianess>
 struct endianess_h : unevaluated<endianess, Endianess> {};
@@ -20,6 +26,10 @@ struct endianess_h : unevaluated<endianess, Endianess> {};
 template<signed_mode Signed_Mode>
 struct signed_mode_h : unevaluated<signed_mode, Signed_Mode> {};
 
+//! \brief \ref<integer_encoding> integer_encoding enumerator holder for named parameters
+template<integer_encoding Integer_Encoding>
+struct integer_encoding_h : unevaluated<integer_encoding, Integer_Encoding> {};
+
 //! \brief Token associated with endianess::LITTLE
 constexpr endianess_h<endianess::LITTLE> little_endian;
 
@@ -38,4 +48,10 @@ constexpr signed_mode_h<signed_mode::TWOS_COMPLEMENT> twos_complement;
 //! \brief Token associated with signed_mode::OFFSET_BINARY
 constexpr signed_mode_h<signed_mode::OFFSET_BINARY> offset_binary;
 
+//! \brief Token associated with integer_encoding::FIXED_WIDTH
+constexpr integer_encoding_h<integer_encoding::FIXED_WIDTH> fixed_width;
+
+//! \brief Token associated with integer_encoding::VARINT
+constexpr integer_encoding_h<integer_encoding::VARINT> varint;
+
 } // namespace upd
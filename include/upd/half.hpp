@@ -0,0 +1,159 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "detail/half_precision.hpp"
+
+namespace upd {
+
+//! \brief IEEE 754 half-precision floating-point number (binary16)
+//!
+//! Instances only hold the 16-bit representation of the value, which is serialized like a `std::uint16_t`. They are
+//! implicitly convertible from and to `float`, so callbacks and callers handle them like regular floating-point values.
+//! Conversions from `float` round to the nearest even representable value. They give the same results on every
+//! platform, whether they are made one by one or with `quantize_n()` and `dequantize_n()`, which make use of the F16C
+//! instructions when available.
+//!
+//! \code
+//! void set_gain(upd::float16 gain) { float g = gain; }
+//!
+//! key(0.75f).write_to(dest);
+//! \endcode
+class float16 {
+  struct raw_tag {};
+
+public:
+  //! \brief Integer type of the serialized representation
+  using representation_t = std::uint16_t;
+
+  //! \brief Floating-point type the instances convert from and to
+  using value_t = float;
+
+  //! \brief Hold positive zero
+  constexpr float16() : m_raw{} {}
+
+  //! \brief Convert a `float` into the nearest half-precision value
+  //! \param x Converted value
+  float16(value_t x) : m_raw{detail::float_to_float16_bits(x)} {}
+
+  //! \brief Make an instance out of its integer representation
+  //! \param raw Integer representation
+  constexpr static float16 from_raw(representation_t raw) { return float16{raw_tag{}, raw}; }
+
+  //! \brief Integer representation of the held value
+  constexpr representation_t raw() const { return m_raw; }
+
+  //! \brief Held value
+  value_t value() const { return detail::float16_bits_to_float(m_raw); }
+
+  //! \copydoc value()
+  operator value_t() const { return value(); }
+
+private:
+  constexpr float16(raw_tag, representation_t raw) : m_raw{raw} {}
+
+  representation_t m_raw;
+};
+
+//! \brief Brain floating-point number (bfloat16)
+//!
+//! bfloat16 values have the same range as `float` values but only 8 bits of precision. As \ref<float16> float16
+//! instances, instances only hold the 16-bit representation of the value and are implicitly convertible from and to
+//! `float`. Conversions from `float` round to the nearest even representable value.
+class bfloat16 {
+  struct raw_tag {};
+
+public:
+  //! \copydoc float16::representation_t
+  using representation_t = std::uint16_t;
+
+  //! \copydoc float16::value_t
+  using value_t = float;
+
+  //! \copydoc float16::float16()
+  constexpr bfloat16() : m_raw{} {}
+
+  //! \brief Convert a `float` into the nearest bfloat16 value
+  //! \param x Converted value
+  bfloat16(value_t x) : m_raw{detail::float_to_bfloat16_bits(x)} {}
+
+  //! \copydoc float16::from_raw
+  constexpr static bfloat16 from_raw(representation_t raw) { return bfloat16{raw_tag{}, raw}; }
+
+  //! \copydoc float16::raw
+  constexpr representation_t raw() const { return m_raw; }
+
+  //! \copydoc float16::value
+  value_t value() const { return detail::bfloat16_bits_to_float(m_raw); }
+
+  //! \copydoc value()
+  operator value_t() const { return value(); }
+
+private:
+  constexpr bfloat16(raw_tag, representation_t raw) : m_raw{raw} {}
+
+  representation_t m_raw;
+};
+
+//! \name
+//! \brief Convert `count` `float` values into half-precision values
+//!
+//! With \ref<float16> float16 values, F16C instructions are used when available (e.g. when compiling with `-mf16c` or
+//! `-mavx2`). With \ref<bfloat16> bfloat16 values, the values are converted in a single loop, which compilers are able
+//! to vectorize.
+//!
+//! \param values Array of values to convert
+//! \param output Array to write the converted values into
+//! \param count Number of values
+//! @{
+
+inline void quantize_n(const float *values, float16 *output, std::size_t count) {
+  // The representations are computed in bulk by chunk, then wrapped one by one
+  constexpr std::size_t chunk_size = 64;
+  std::uint16_t chunk[chunk_size];
+  for (std::size_t i = 0; i < count; i += chunk_size) {
+    auto n = count - i < chunk_size ? count - i : chunk_size;
+    detail::float_to_float16_bits_n(values + i, chunk, n);
+    for (std::size_t j = 0; j < n; j++)
+      output[i + j] = float16::from_raw(chunk[j]);
+  }
+}
+inline void quantize_n(const float *values, bfloat16 *output, std::size_t count) {
+  for (std::size_t i = 0; i < count; i++)
+    output[i] = bfloat16::from_raw(detail::float_to_bfloat16_bits(values[i]));
+}
+
+//! @}
+
+//! \name
+//! \brief Convert `count` half-precision values into `float` values
+//!
+//! The conversions are exact. As with `quantize_n()`, F16C instructions are used with \ref<float16> float16 values
+//! when available.
+//!
+//! \param values Array of values to convert
+//! \param output Array to write the converted values into
+//! \param count Number of values
+//! @{
+
+inline void dequantize_n(const float16 *values, float *output, std::size_t count) {
+  constexpr std::size_t chunk_size = 64;
+  std::uint16_t chunk[chunk_size];
+  for (std::size_t i = 0; i < count; i += chunk_size) {
+    auto n = count - i < chunk_size ? count - i : chunk_size;
+    for (std::size_t j = 0; j < n; j++)
+      chunk[j] = values[i + j].raw();
+    detail::float16_bits_to_float_n(chunk, output + i, n);
+  }
+}
+inline void dequantize_n(const bfloat16 *values, float *output, std::size_t count) {
+  for (std::size_t i = 0; i < count; i++)
+    output[i] = values[i].value();
+}
+
+//! @}
+
+} // namespace upd
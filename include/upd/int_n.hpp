@@ -0,0 +1,107 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "detail/type_traits/smallest.hpp"
+
+namespace upd {
+
+//! \brief Unsigned integer serialized in `Bits` bits rounded up to a whole number of bytes
+//!
+//! Many devices produce integers whose width is not a power of 2 (such as 24-bit ADC samples). A \ref<uint_n> uint_n
+//! instance holds such an integer in the smallest standard integer type able to hold it, but is only serialized in
+//! `(Bits + 7) / 8` bytes. Instances are implicitly convertible from and to `value_t`, so callbacks and callers handle
+//! them like regular integers. Arrays of them are packed and unpacked in bulk.
+//!
+//! \code
+//! void push_samples(const std::array<upd::uint_n<24>, 64> &samples); // 192 bytes instead of 256
+//! \endcode
+//!
+//! \tparam Bits Width of the integer, at most 64
+template<std::size_t Bits>
+class uint_n {
+  static_assert(Bits > 0 && Bits <= 64, "The width of an uint_n instance must be between 1 and 64 bits");
+
+public:
+  //! \brief Smallest standard unsigned integer type holding `Bits` bits
+  using value_t = detail::smallest_unsigned_t<(~0ull >> (64 - Bits))>;
+
+  //! \brief Width of the integer in bits
+  constexpr static auto width = Bits;
+
+  //! \brief Size of the serialized representation in bytes
+  constexpr static std::size_t size = (Bits + 7) / 8;
+
+  //! \brief Hold zero
+  constexpr uint_n() : m_value{} {}
+
+  //! \brief Hold the `Bits` least significant bits of `x`
+  //! \param x Held value
+  constexpr uint_n(value_t x) : m_value{value_t(x & mask)} {}
+
+  //! \brief Held value
+  constexpr value_t value() const { return m_value; }
+
+  //! \copydoc value()
+  constexpr operator value_t() const { return m_value; }
+
+private:
+  constexpr static value_t mask = value_t(~0ull >> (64 - Bits));
+
+  value_t m_value;
+};
+
+//! \brief Signed integer serialized in `Bits` bits rounded up to a whole number of bytes
+//!
+//! \ref<int_n> int_n instances are the signed counterpart of \ref<uint_n> uint_n instances. They are serialized in
+//! any of the signed number representations, applied to a `Bits`-bit wide integer.
+//!
+//! \tparam Bits Width of the integer, at most 64
+template<std::size_t Bits>
+class int_n {
+  static_assert(Bits > 0 && Bits <= 64, "The width of an int_n instance must be between 1 and 64 bits");
+
+  using unsigned_t = typename uint_n<Bits>::value_t;
+
+public:
+  //! \brief Smallest standard signed integer type holding `Bits` bits
+  using value_t = typename std::make_signed<unsigned_t>::type;
+
+  //! \copydoc uint_n::width
+  constexpr static auto width = Bits;
+
+  //! \copydoc uint_n::size
+  constexpr static std::size_t size = (Bits + 7) / 8;
+
+  //! \copydoc uint_n::uint_n()
+  constexpr int_n() : m_value{} {}
+
+  //! \brief Hold the value represented by the `Bits` least significant bits of `x` in two's complement
+  //!
+  //! Values representable in `Bits` bits are held unchanged.
+  //!
+  //! \param x Held value
+  constexpr int_n(value_t x) : m_value{sign_extend(unsigned_t(x))} {}
+
+  //! \copydoc uint_n::value
+  constexpr value_t value() const { return m_value; }
+
+  //! \copydoc value()
+  constexpr operator value_t() const { return m_value; }
+
+private:
+  constexpr static unsigned_t mask = unsigned_t(~0ull >> (64 - Bits));
+  constexpr static unsigned_t sign = unsigned_t(1ull << (Bits - 1));
+
+  // Does not depend on the platform signed representation nor overflows
+  constexpr static value_t sign_extend(unsigned_t x) {
+    return x & sign ? value_t(-value_t(unsigned_t(~x & mask)) - 1) : value_t(x & mask);
+  }
+
+  value_t m_value;
+};
+
+} // namespace upd
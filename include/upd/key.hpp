@@ -5,9 +5,11 @@
 #include <type_traits>
 
 #include "action.hpp"
+#include "detail/encoding.hpp"
 #include "detail/io/immediate_reader.hpp"
 #include "detail/serialized_message.hpp"
 #include "detail/static_error.hpp"
+#include "detail/type_traits/flatten_tuple.hpp"
 #include "detail/type_traits/remove_cv_ref.hpp"
 #include "detail/type_traits/require.hpp"
 #include "detail/type_traits/signature.hpp"
@@ -18,8 +20,13 @@
 
 namespace upd {
 
-template<typename Index_T, Index_T Index, typename F, endianess Endianess, signed_mode Signed_Mode>
-class key : public key<Index_T, Index, detail::signature_t<F>, Endianess, Signed_Mode> {
+template<typename Index_T,
+         Index_T Index,
+         typename F,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding>
+class key : public key<Index_T, Index, detail::signature_t<F>, Endianess, Signed_Mode, Integer_Encoding> {
   static_assert(detail::is_invocable<F>::value, UPD_ERROR_NOT_INVOCABLE(F));
 };
 
@@ -50,6 +57,13 @@ class key : public key<Index_T, Index, detail::signature_t<F>, Endianess, Signed
 //!   - 2 bytes for the first argument of `function2` (type: `uint16_t`; value: 7)
 //!   - 4 bytes for the second argument of `function2` (type: `uint32_t`; value: 21)
 //!
+//! If the keyring was created with the `upd::varint` token, every integer of the payload wider than one byte (and every
+//! element of such an integer array) is written as a LEB128 varint instead, after a zigzag encoding if its type is
+//! signed. In the example above, the arguments would then occupy a single byte each. The index keeps its fixed width.
+//!
+//! Arguments of type \ref<bounded_vector> bounded_vector or \ref<bounded_string> bounded_string are written as their
+//! length followed by the elements they actually hold, so `payload_length` is only the length of the longest packet.
+//!
 //! When the packet has been processed by the callee device and the resulting value is sent back to the caller device,
 //! keys can be used to extract this value from the callee response. The syntax to achieve that is `auto x =
 //! key.read_from(/*a byte getter*/)`. However, \ref<key> key instances being templated, it is hard to store them
@@ -59,17 +73,30 @@ class key : public key<Index_T, Index, detail::signature_t<F>, Endianess, Signed
 //!
 //! \tparam Index Index of the action in the keyring
 //! \tparam F Signature of the callback associated with the key
-//! \tparam Endianess, Signed_Mode Serialization parameters
+//! \tparam Endianess, Signed_Mode, Integer_Encoding Serialization parameters
 #if defined(DOXYGEN)
-template<typename Index_T, Index_T Index, typename F, endianess Endianess, signed_mode Signed_Mode>
+template<typename Index_T,
+         Index_T Index,
+         typename F,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding>
 class key
 #else  // defined(DOXYGEN)
-template<typename Index_T, Index_T Index, typename R, typename... Args, endianess Endianess, signed_mode Signed_Mode>
-class key<Index_T, Index, R(Args...), Endianess, Signed_Mode>
-    : public detail::immediate_reader<key<Index_T, Index, R(Args...), Endianess, Signed_Mode>,
+template<typename Index_T,
+         Index_T Index,
+         typename R,
+         typename... Args,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding>
+class key<Index_T, Index, R(Args...), Endianess, Signed_Mode, Integer_Encoding>
+    : public detail::immediate_reader<key<Index_T, Index, R(Args...), Endianess, Signed_Mode, Integer_Encoding>,
                                       detail::remove_cv_ref_t<R>>
 #endif // defined(DOXYGEN)
 {
+  using this_t = key<Index_T, Index, R(Args...), Endianess, Signed_Mode, Integer_Encoding>;
+
 public:
   //! \brief Type of the index as found in the packets generated by this key
   using index_t = Index_T;
@@ -92,39 +119,53 @@ public:
   //! \brief Equals the `Signed_Mode` template parameter
   constexpr static auto signed_mode = Signed_Mode;
 
+  //! \brief Equals the `Integer_Encoding` template parameter
+  constexpr static auto integer_encoding = Integer_Encoding;
+
   //! \brief Equals the length in bytes of an action request produced by this key
-  constexpr static auto payload_length = sizeof(Index_T) + detail::parameters_size<R(Args...)>::value;
+  //!
+  //! With the `integer_encoding::VARINT` encoding or bounded sequence parameters, this is the length of the longest
+  //! possible action request.
+  constexpr static auto payload_length =
+      sizeof(Index_T) + detail::encoded_parameters_size<Integer_Encoding, R(Args...)>::value;
 
   //! \brief Generate a packet ready to be sent
   //!
   //! This allows the following syntax : `key(x1, x2, x3, ...).write_to(dest)` (with `dest` being a byte putter). `dest`
   //! is invoked on every byte representing the data passed as parameter, in the action they appear in the packet.
   //!
+  //! Since C++17, the packet can be generated in a constant expression and turned into an array of bytes with its
+  //! `to_array()` member function, provided that its length does not depend on the values of the arguments:
+  //! `constexpr auto packet = key(x1, x2, x3, ...).to_array();`.
+  //!
   //! \param args... Values to insert in the payload
   //! \return a temporary object allowing the syntax mentioned above
 #if defined(DOXYGEN)
   auto operator()(const Args &...args) const;
 #else  // defined(DOXYGEN)
-  detail::serialized_message<Endianess, Signed_Mode, Index_T, detail::remove_cv_ref_t<Args>...>
+  UPD_CONSTEXPR17
+  detail::serialized_message<Endianess, Signed_Mode, Integer_Encoding, Index_T, detail::remove_cv_ref_t<Args>...>
   operator()(const Args &...args) const {
     return {Index, args...};
   }
 #endif // defined(DOXYGEN)
 
-  using detail::immediate_reader<key<Index_T, Index, R(Args...), Endianess, Signed_Mode>, return_t>::read_from;
+  using detail::immediate_reader<this_t, return_t>::read_from;
 
   //! \brief Unserialize a value from a packet sent by a callee device in response to a packet generated by this key
   //! \copydoc ImmediateReader_CRTP
   //!
+  //! If the callback returns a `std::tuple`, `std::pair` or \ref<tuple> tuple instance, the response holds each of its
+  //! elements and an instance of the same type is returned.
+  //!
   //! \param src Byte getter
   //! \return the unserialized value
   template<typename Src, UPD_REQUIREMENT(input_invocable, Src), UPD_REQUIRE_CLASS(!std::is_void<return_t>::value)>
   return_t read_from(Src &&src) const {
-    tuple<Endianess, Signed_Mode, detail::remove_cv_ref_t<R>> retval;
-    for (auto &byte : retval)
-      byte = UPD_FWD(src)();
+    detail::flatten_tuple_t<Endianess, Signed_Mode, return_t> retval{uninitialized};
+    detail::read_fields<Integer_Encoding>(retval, src);
 
-    return retval.template get<0>();
+    return detail::from_response_tuple(retval, static_cast<return_t *>(nullptr));
   }
 
   template<typename Src, UPD_REQUIREMENT(input_invocable, Src), UPD_REQUIRE_CLASS(std::is_void<return_t>::value)>
@@ -137,7 +178,8 @@ public:
   //! \return an action holding the provided hook
   template<typename F, UPD_REQUIREMENT(invocable, F)>
   action with_hook(F &&ftor) const {
-    return action{UPD_FWD(ftor), endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}};
+    return action{
+        UPD_FWD(ftor), endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, integer_encoding_h<Integer_Encoding>{}};
   }
 
   //! \copybrief with_hook
@@ -145,7 +187,10 @@ public:
   //! \return an action holding the provided hook
   template<typename F, F Ftor, UPD_REQUIREMENT(invocable, F)>
   no_storage_action with_hook(unevaluated<F, Ftor>) const {
-    return no_storage_action{unevaluated<F, Ftor>{}, endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}};
+    return no_storage_action{unevaluated<F, Ftor>{},
+                             endianess_h<Endianess>{},
+                             signed_mode_h<Signed_Mode>{},
+                             integer_encoding_h<Integer_Encoding>{}};
   }
 
 #if __cplusplus >= 201703L
@@ -161,7 +206,11 @@ public:
   UPD_SFINAE_FAILURE_MEMBER(with_hook, UPD_ERROR_NOT_INVOCABLE(F))
 };
 
-template<typename Index_T, Index_T Index, endianess Endianess, signed_mode Signed_Mode>
-class key<Index_T, Index, detail::no_signature, Endianess, Signed_Mode> {};
+template<typename Index_T,
+         Index_T Index,
+         endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding>
+class key<Index_T, Index, detail::no_signature, Endianess, Signed_Mode, Integer_Encoding> {};
 
 } // namespace upd
@@ -31,14 +31,24 @@ class keyring {};
 //! the value received from the callee. Keyrings also holds the endianess and signed number representation of the data
 //! in the packets. \see \ref<key> key for further information on how packets are generated.
 //!
+//! The integers in the packets are laid out with their fixed width, unless the keyring is created with the
+//! `upd::varint` token (e.g. `keyring{flist<f, g>, little_endian, twos_complement, varint}`). In that case, the
+//! instance is a `keyring<Endianess, Signed_Mode, integer_encoding_h<integer_encoding::VARINT>, Hs...>` and the
+//! integers are written as LEB128 varints, which makes the length of a packet depend on its content.
+//!
 //! \tparam Endianess, Signed_Mode Serialization parameters
-//! \tparam Hs Unevaluated references to callbacks available for calling
+//! \tparam Hs Unevaluated references to callbacks available for calling, optionally preceded by an
+//! \ref<integer_encoding> integer_encoding enumerator holder
 #ifdef DOXYGEN
 template<endianess Endianess, signed_mode Signed_Mode, typename... Hs>
 class keyring
 #else  // DOXYGEN
-template<endianess Endianess, signed_mode Signed_Mode, typename... Fs, Fs... Functions>
-class keyring<Endianess, Signed_Mode, unevaluated<Fs, Functions>...>
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         typename... Fs,
+         Fs... Functions>
+class keyring<Endianess, Signed_Mode, integer_encoding_h<Integer_Encoding>, unevaluated<Fs, Functions>...>
 #endif // DOXYGEN
 {
 public:
@@ -58,7 +68,8 @@ public:
                     detail::find<flist_t, H>::value,
                     typename std::remove_pointer<typename H::type>::type,
                     Endianess,
-                    Signed_Mode>;
+                    Signed_Mode,
+                    Integer_Encoding>;
 
   //! \brief Number of managed callbacks
   constexpr static index_t size = sizeof...(Fs);
@@ -69,15 +80,17 @@ public:
   //! \brief Signed number representation of the data in the packets built by the keys
   constexpr static auto signed_mode = Signed_Mode;
 
+  //! \brief Integer encoding of the data in the packets built by the keys
+  constexpr static auto integer_encoding = Integer_Encoding;
+
 #if __cplusplus >= 201703L
   constexpr keyring() = default;
 
   //! \brief (C++17) Create a keyring managing the given callbacks with the provided serialization parameters
   constexpr explicit keyring(upd::flist_t<unevaluated<Fs, Functions>...>,
                              endianess_h<Endianess>,
-                             signed_mode_h<Signed_Mode>) {}
-
-  constexpr explicit keyring(upd::flist_t<unevaluated<Fs, Functions>...> fl) {}
+                             signed_mode_h<Signed_Mode>,
+                             integer_encoding_h<Integer_Encoding>) {}
 #endif // __cplusplus >= 201703L
 
   //! \brief Make a key associated with the given unevaluated reference to a callback
@@ -97,10 +110,34 @@ public:
 #endif // __cplusplus >= 201703L
 };
 
+#ifndef DOXYGEN
+template<endianess Endianess, signed_mode Signed_Mode, typename... Fs, Fs... Functions>
+class keyring<Endianess, Signed_Mode, unevaluated<Fs, Functions>...>
+    : public keyring<Endianess,
+                     Signed_Mode,
+                     integer_encoding_h<integer_encoding::FIXED_WIDTH>,
+                     unevaluated<Fs, Functions>...> {
+public:
+#if __cplusplus >= 201703L
+  constexpr keyring() = default;
+
+  constexpr explicit keyring(upd::flist_t<unevaluated<Fs, Functions>...>,
+                             endianess_h<Endianess>,
+                             signed_mode_h<Signed_Mode>) {}
+
+  constexpr explicit keyring(upd::flist_t<unevaluated<Fs, Functions>...> fl) {}
+#endif // __cplusplus >= 201703L
+};
+#endif // DOXYGEN
+
 #if __cplusplus >= 201703L
 template<typename... Hs, endianess Endianess, signed_mode Signed_Mode>
 keyring(flist_t<Hs...>, endianess_h<Endianess>, signed_mode_h<Signed_Mode>) -> keyring<Endianess, Signed_Mode, Hs...>;
 
+template<typename... Hs, endianess Endianess, signed_mode Signed_Mode, integer_encoding Integer_Encoding>
+keyring(flist_t<Hs...>, endianess_h<Endianess>, signed_mode_h<Signed_Mode>, integer_encoding_h<Integer_Encoding>)
+    -> keyring<Endianess, Signed_Mode, integer_encoding_h<Integer_Encoding>, Hs...>;
+
 template<typename... Hs>
 keyring(flist_t<Hs...>) -> keyring<endianess::LITTLE, signed_mode::TWOS_COMPLEMENT, Hs...>;
 #endif // __cplusplus >= 201703L
@@ -113,4 +150,12 @@ make_keyring(flist_t<Hs...>, endianess_h<Endianess>, signed_mode_h<Signed_Mode>)
   return {};
 }
 
+//! \copydoc make_keyring
+//! \related keyring
+template<endianess Endianess, signed_mode Signed_Mode, integer_encoding Integer_Encoding, typename... Hs>
+constexpr keyring<Endianess, Signed_Mode, integer_encoding_h<Integer_Encoding>, Hs...>
+make_keyring(flist_t<Hs...>, endianess_h<Endianess>, signed_mode_h<Signed_Mode>, integer_encoding_h<Integer_Encoding>) {
+  return {};
+}
+
 } // namespace upd
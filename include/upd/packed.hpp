@@ -0,0 +1,183 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "detail/type_traits/index_sequence.hpp"
+#include "detail/type_traits/smallest.hpp"
+#include "detail/type_traits/typelist.hpp"
+#include "type.hpp"
+#include "typelist.hpp"
+
+namespace upd {
+
+//! \brief Field of `N` bits holding a value of type `T`, meant to be packed with adjacent fields in a \ref<packed>
+//! packed instance
+//!
+//! `T` may be `bool`, an unsigned integer type or an enumeration type whose enumerators are not negative. Only the `N`
+//! least significant bits of the values are stored.
+//!
+//! \tparam N Width of the field in bits
+//! \tparam T Type of the value held by the field (defaults to the smallest unsigned integer type holding `N` bits)
+template<std::size_t N, typename T = detail::smallest_unsigned_t<(N >= 64 ? ~0ull : (1ull << N) - 1)>>
+struct bits {
+  static_assert(N > 0 && N <= 32, "A bit field must be between 1 and 32 bits wide");
+
+  //! \brief Type of the value held by the field
+  using value_t = T;
+
+  //! \brief Width of the field in bits
+  constexpr static std::size_t width = N;
+};
+
+namespace detail {
+
+//! \name
+//! \brief Bit field descriptor of the field type `T` in a \ref<packed> packed instance
+//!
+//! `bool` occupies a single bit, other types are as wide as their object representation unless they are wrapped in
+//! \ref<bits> bits.
+//! @{
+
+template<typename T>
+struct bit_field : bits<8 * sizeof(T), T> {};
+template<>
+struct bit_field<bool> : bits<1, bool> {};
+template<std::size_t N, typename T>
+struct bit_field<bits<N, T>> : bits<N, T> {};
+
+//! @}
+
+//! \brief Width in bits of the field type `T` in a \ref<packed> packed instance
+template<typename T>
+using bit_width = std::integral_constant<std::size_t, bit_field<T>::width>;
+
+} // namespace detail
+
+//! \brief Sequence of sub-byte fields sharing the same bytes
+//!
+//! A \ref<tuple> tuple field is at least one byte wide, so a `bool` or a 3-bit mode costs a whole byte in a packet.
+//! Grouping such fields in a \ref<packed> packed instance lays them out one after the other, without padding: the
+//! first field occupies the least significant bits of the first byte, the following ones occupy the next bits,
+//! spanning several bytes if needed. The layout is computed at compile time and fields are accessed with masked
+//! shifts.
+//!
+//! \ref<packed> packed instances are serializable, so they may be held in a \ref<tuple> tuple, passed as arguments to a
+//! \ref<key> key or taken as parameters by a callback managed by an \ref<action> action. They are as many bytes wide
+//! as needed to hold all their fields. When serialized, these bytes are ordered as those of an unsigned integer of the
+//! same width, according to the endianess of the serialization.
+//!
+//! \code
+//! enum class mode : uint8_t { IDLE, LOW, HIGH, BLINK };
+//!
+//! // 16 flags fit in 2 bytes instead of 16
+//! void set_outputs(upd::packed<bool, bool, bool, bool, bool, bool, bool, bool,
+//!                              bool, bool, bool, bool, bool, bool, bool, bool>);
+//!
+//! // 1 + 3 + 4 bits fit in a single byte
+//! void configure(upd::packed<bool, upd::bits<3, mode>, upd::bits<4>>);
+//! \endcode
+//!
+//! \tparam Ts Types of the fields (`bool`, \ref<bits> bits instances, unsigned integers or enumerations)
+template<typename... Ts>
+class packed {
+  using widths_t = upd::typelist_t<detail::bit_width<Ts>...>;
+
+  template<std::size_t I>
+  using offset_t = detail::sum<detail::clip<widths_t, 0, I>>;
+
+  template<std::size_t I>
+  using field_t = detail::bit_field<detail::at<upd::typelist_t<Ts...>, I>>;
+
+public:
+  //! \brief Type of the value held by the `I`-th field
+  template<std::size_t I>
+  using arg_t = typename field_t<I>::value_t;
+
+  //! \brief Number of fields
+  constexpr static std::size_t count = sizeof...(Ts);
+
+  //! \brief Total width of the fields in bits
+  constexpr static std::size_t width = detail::sum<widths_t>::value;
+
+  //! \brief Size of the packed fields in bytes
+  constexpr static std::size_t size = (width + 7) / 8;
+
+  static_assert(size != 0, "A packed instance must hold at least one field");
+
+  //! \brief Initialize every field to zero
+  packed() : m_bytes{} {}
+
+  //! \brief Initialize the fields with the provided values
+  packed(const typename detail::bit_field<Ts>::value_t &...values) : m_bytes{} {
+    lay(detail::make_index_sequence<sizeof...(Ts)>{}, values...);
+  }
+
+  //! \brief Get the value of one of the fields
+  //! \tparam I Index of the field
+  //! \return a copy of the value held by the field
+  template<std::size_t I>
+  arg_t<I> get() const {
+    constexpr auto offset = offset_t<I>::value;
+    constexpr auto mask = (std::uint64_t(1) << field_t<I>::width) - 1;
+
+    auto word = std::uint64_t(0);
+    for (std::size_t i = offset / 8, shift = 0; i * 8 < offset + field_t<I>::width; i++, shift += 8)
+      word |= std::uint64_t(m_bytes[i]) << shift;
+
+    return arg_t<I>(word >> offset % 8 & mask);
+  }
+
+  //! \brief Set the value of one of the fields
+  //! \tparam I Index of the field
+  //! \param value Value to be held by the field
+  template<std::size_t I>
+  void set(const arg_t<I> &value) {
+    constexpr auto offset = offset_t<I>::value;
+    constexpr auto mask = ((std::uint64_t(1) << field_t<I>::width) - 1) << offset % 8;
+
+    auto word = std::uint64_t(value) << offset % 8 & mask;
+    for (std::size_t i = offset / 8, shift = 0; i * 8 < offset + field_t<I>::width; i++, shift += 8)
+      m_bytes[i] = byte_t((m_bytes[i] & ~(mask >> shift)) | word >> shift);
+  }
+
+  //! \brief Get an iterator to the bytes holding the fields (from the least significant one)
+  byte_t *begin() { return m_bytes; }
+
+  //! \copydoc begin()
+  const byte_t *begin() const { return m_bytes; }
+
+  //! \brief Get an iterator past the bytes holding the fields
+  byte_t *end() { return m_bytes + size; }
+
+  //! \copydoc end()
+  const byte_t *end() const { return m_bytes + size; }
+
+private:
+  template<std::size_t... Is, typename... Args>
+  void lay(detail::index_sequence<Is...>, const Args &...args) {
+    using discard = int[];
+    (void)discard{0, (set<Is>(args), 0)...};
+  }
+
+  byte_t m_bytes[size];
+};
+
+//! \brief Get the value of one of the fields of a \ref<packed> packed instance
+//! \related packed
+template<std::size_t I, typename... Ts>
+typename packed<Ts...>::template arg_t<I> get(const packed<Ts...> &p) {
+  return p.template get<I>();
+}
+
+//! \brief Set the value of one of the fields of a \ref<packed> packed instance
+//! \related packed
+template<std::size_t I, typename... Ts>
+void set(packed<Ts...> &p, const typename packed<Ts...>::template arg_t<I> &value) {
+  p.template set<I>(value);
+}
+
+} // namespace upd
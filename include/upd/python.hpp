@@ -166,7 +166,7 @@ void declare_dispatcher(pybind11::module &pymodule, const char *name, Keyring ke
       .def(pybind11::init<>())
       .def("read_from", [](dispatcher_t &self, const std::function<byte_t()> &src) { return self.read_from(src); })
       .def("write_to", [](dispatcher_t &self, const std::function<void(byte_t)> &dest) { self.write_to(dest); })
-      .def("put", &dispatcher_t::put)
+      .def("put", [](dispatcher_t &self, byte_t byte) { return self.put(byte); })
       .def("get", &dispatcher_t::get)
       .def("is_loaded", &dispatcher_t::is_loaded)
       .def("replace", [](dispatcher_t &self, pybind11::object pykey, pybind11::function pyfunction) {
@@ -0,0 +1,151 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+namespace upd {
+
+//! \brief Real number serialized as an integer with a fixed scale and offset
+//!
+//! Physical quantities (angles, currents, temperatures, ...) rarely need the precision of a `float`. A real number `x`
+//! held by a \ref<scaled> scaled instance is quantized as the integer `round((x - Offset) / Scale)` of type `Int_T`,
+//! saturated to the range of `Int_T`, and only that integer is serialized. Instances are implicitly convertible from
+//! and to `value_t`, so callbacks and callers handle them like regular floating-point values. Instances only hold that
+//! integer, so arrays of them are serialized in bulk like arrays of integers, and `quantize_n()` and `dequantize_n()`
+//! convert whole arrays at once.
+//!
+//! \code
+//! // Temperatures between -40 and 615.35 degrees with a resolution of 0.01 degree, serialized in 2 bytes
+//! using temperature_t = upd::scaled<std::uint16_t, std::ratio<1, 100>, std::ratio<-40>>;
+//!
+//! void set_temperature(temperature_t t) { float target = t; }
+//!
+//! key(21.5f).write_to(dest);
+//! \endcode
+//!
+//! \tparam Int_T Integer type of the serialized representation
+//! \tparam Scale `std::ratio` instance representing the difference between two consecutive representable values
+//! \tparam Offset `std::ratio` instance representing the value whose representation is zero
+template<typename Int_T, typename Scale, typename Offset = std::ratio<0>>
+class scaled {
+  static_assert(std::is_integral<Int_T>::value && !std::is_same<Int_T, bool>::value,
+                "The representation of a scaled value must be an integer type");
+  static_assert(sizeof(Int_T) <= 4, "The representation of a scaled value must be at most 32 bits wide");
+  static_assert(Scale::num > 0, "The scale of a scaled value must be positive");
+
+  struct raw_tag {};
+
+public:
+  //! \brief Integer type of the serialized representation
+  using representation_t = Int_T;
+
+  //! \brief Floating-point type the instances convert from and to
+  //!
+  //! This is `float` if `Int_T` is at most 16 bits wide and `double` otherwise, so that every integer representation is
+  //! exactly converted.
+  using value_t = typename std::conditional<(sizeof(Int_T) <= 2), float, double>::type;
+
+  //! \brief Hold the value `Offset`
+  constexpr scaled() : m_raw{} {}
+
+  //! \brief Quantize a real number
+  //! \param x Quantized value
+  constexpr scaled(value_t x) : m_raw{quantize(x)} {}
+
+  //! \brief Make an instance out of its integer representation
+  //! \param raw Integer representation
+  constexpr static scaled from_raw(representation_t raw) { return scaled{raw_tag{}, raw}; }
+
+  //! \brief Integer representation of the held value
+  constexpr representation_t raw() const { return m_raw; }
+
+  //! \brief Held value
+  constexpr value_t value() const { return value_t(m_raw) * scale() + offset(); }
+
+  //! \copydoc value()
+  constexpr operator value_t() const { return value(); }
+
+  //! \brief Difference between two consecutive representable values
+  constexpr static value_t scale() { return value_t(Scale::num) / value_t(Scale::den); }
+
+  //! \brief Value whose integer representation is zero
+  constexpr static value_t offset() { return value_t(Offset::num) / value_t(Offset::den); }
+
+  //! \brief Compute the integer representation of the nearest representable value
+  //!
+  //! Values out of the representable range (and NaN) are saturated.
+  //!
+  //! \param x Quantized value
+  constexpr static representation_t quantize(value_t x) {
+    return round(clamp((x - offset()) * (value_t(Scale::den) / value_t(Scale::num))));
+  }
+
+private:
+  constexpr scaled(raw_tag, representation_t raw) : m_raw{raw} {}
+
+  // The bounds are exactly representable since `value_t` has at least as many mantissa bits as `Int_T` has bits
+  constexpr static value_t clamp(value_t x) {
+    return x > value_t(std::numeric_limits<Int_T>::min())
+               ? (x < value_t(std::numeric_limits<Int_T>::max()) ? x : value_t(std::numeric_limits<Int_T>::max()))
+               : value_t(std::numeric_limits<Int_T>::min());
+  }
+
+  // Only selects between floating-point values, so that loops calling it can be vectorized
+  constexpr static representation_t round(value_t x) { return Int_T(x < 0 ? x - value_t(0.5) : x + value_t(0.5)); }
+
+  representation_t m_raw;
+};
+
+//! \brief Real number serialized as a fixed-point number with `Frac_Bits` fractional bits
+//!
+//! \code
+//! // Angles between -128 and 128 degrees with a resolution of 1/256 degree, serialized in 2 bytes
+//! using angle_t = upd::fixed<std::int16_t, 8>;
+//! \endcode
+//!
+//! \tparam Int_T Integer type of the serialized representation
+//! \tparam Frac_Bits Number of fractional bits
+template<typename Int_T, std::size_t Frac_Bits>
+using fixed = scaled<Int_T, std::ratio<1, (std::intmax_t(1) << Frac_Bits)>>;
+
+//! \brief Quantize `count` real numbers
+//!
+//! The values are quantized in a single loop, which compilers are able to vectorize (GCC requires
+//! `-fno-trapping-math` to do so, since the values are compared to the bounds of the representable range).
+//!
+//! \param values Array of values to quantize
+//! \param output Array to write the quantized values into
+//! \param count Number of values
+//! \related scaled
+template<typename Int_T, typename Scale, typename Offset>
+void quantize_n(const typename scaled<Int_T, Scale, Offset>::value_t *values,
+                scaled<Int_T, Scale, Offset> *output,
+                std::size_t count) {
+  using scaled_t = scaled<Int_T, Scale, Offset>;
+
+  for (std::size_t i = 0; i < count; i++)
+    output[i] = scaled_t::from_raw(scaled_t::quantize(values[i]));
+}
+
+//! \brief Convert `count` quantized values into real numbers
+//!
+//! The values are converted in a single loop, which compilers are able to vectorize.
+//!
+//! \param values Array of quantized values
+//! \param output Array to write the real numbers into
+//! \param count Number of values
+//! \related scaled
+template<typename Int_T, typename Scale, typename Offset>
+void dequantize_n(const scaled<Int_T, Scale, Offset> *values,
+                  typename scaled<Int_T, Scale, Offset>::value_t *output,
+                  std::size_t count) {
+  for (std::size_t i = 0; i < count; i++)
+    output[i] = values[i].value();
+}
+
+} // namespace upd
@@ -0,0 +1,134 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+#include "type.hpp"
+
+namespace upd {
+
+//! \brief Random access iterator over a byte sequence split in two contiguous segments
+//!
+//! Circular buffers, such as those filled by DMA controllers, hold packets which may wrap past their end. Such a packet
+//! is made of two segments: the one ending at the end of the buffer and the one starting at its beginning. Binding a
+//! \ref<tuple_view> tuple_view to a \ref<segmented_iterator> segmented_iterator allows decoding the packet without
+//! copying it into a linear buffer first: each value is read or written in place, unless its representation
+//! straddles both segments, in which case it is assembled byte by byte.
+//!
+//! \code
+//! // The packet starts 6 bytes before the end of the ring buffer
+//! upd::byte_t ring[64];
+//! auto view = upd::make_view<std::uint32_t, std::uint32_t>(
+//!     upd::little_endian, upd::twos_complement, upd::segmented_iterator{ring + 58, 6, ring, 58});
+//!
+//! auto x = view.get<0>(); // read in place
+//! auto y = view.get<1>(); // straddles both segments
+//! \endcode
+class segmented_iterator {
+public:
+  //! \brief Iterator category
+  using iterator_category = std::random_access_iterator_tag;
+
+  //! \brief Type of the elements of the sequence
+  using value_type = byte_t;
+
+  //! \brief Type of the distance between two iterators
+  using difference_type = std::ptrdiff_t;
+
+  //! \brief Pointer to an element of the sequence
+  using pointer = byte_t *;
+
+  //! \brief Reference to an element of the sequence
+  using reference = byte_t &;
+
+  //! \brief Make an iterator which does not designate any sequence
+  segmented_iterator() : segmented_iterator{nullptr, 0, nullptr, 0} {}
+
+  //! \brief Make an iterator to the beginning of a sequence split in two segments
+  //! \param first Beginning of the first segment
+  //! \param first_size Size of the first segment
+  //! \param second Beginning of the second segment
+  //! \param second_size Size of the second segment
+  segmented_iterator(byte_t *first, std::size_t first_size, byte_t *second, std::size_t second_size)
+      : m_first{first}, m_first_size{first_size}, m_second{second}, m_second_size{second_size}, m_offset{0} {}
+
+  //! \brief Get a pointer to the designated byte
+  byte_t *get() const { return m_offset < m_first_size ? m_first + m_offset : m_second + (m_offset - m_first_size); }
+
+  //! \brief Number of bytes which are stored contiguously from the designated one
+  std::size_t contiguous_size() const {
+    return m_offset < m_first_size ? m_first_size - m_offset : m_first_size + m_second_size - m_offset;
+  }
+
+  //! \name
+  //! \brief Iterator interface
+  //! @{
+
+  reference operator*() const { return *get(); }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  segmented_iterator &operator++() { return *this += 1; }
+  segmented_iterator &operator--() { return *this -= 1; }
+
+  segmented_iterator operator++(int) {
+    auto retval = *this;
+    ++*this;
+    return retval;
+  }
+
+  segmented_iterator operator--(int) {
+    auto retval = *this;
+    --*this;
+    return retval;
+  }
+
+  segmented_iterator &operator+=(difference_type n) {
+    m_offset = std::size_t(difference_type(m_offset) + n);
+    return *this;
+  }
+
+  segmented_iterator &operator-=(difference_type n) { return *this += -n; }
+
+  friend segmented_iterator operator+(segmented_iterator it, difference_type n) { return it += n; }
+  friend segmented_iterator operator+(difference_type n, segmented_iterator it) { return it += n; }
+  friend segmented_iterator operator-(segmented_iterator it, difference_type n) { return it -= n; }
+
+  friend difference_type operator-(const segmented_iterator &lhs, const segmented_iterator &rhs) {
+    return difference_type(lhs.m_offset) - difference_type(rhs.m_offset);
+  }
+
+  friend bool operator==(const segmented_iterator &lhs, const segmented_iterator &rhs) {
+    return lhs.m_offset == rhs.m_offset;
+  }
+  friend bool operator!=(const segmented_iterator &lhs, const segmented_iterator &rhs) { return !(lhs == rhs); }
+  friend bool operator<(const segmented_iterator &lhs, const segmented_iterator &rhs) {
+    return lhs.m_offset < rhs.m_offset;
+  }
+  friend bool operator>(const segmented_iterator &lhs, const segmented_iterator &rhs) { return rhs < lhs; }
+  friend bool operator<=(const segmented_iterator &lhs, const segmented_iterator &rhs) { return !(rhs < lhs); }
+  friend bool operator>=(const segmented_iterator &lhs, const segmented_iterator &rhs) { return !(lhs < rhs); }
+
+  //! @}
+
+private:
+  byte_t *m_first;
+  std::size_t m_first_size;
+  byte_t *m_second;
+  std::size_t m_second_size, m_offset;
+};
+
+//! \brief Make an iterator to a sequence stored in a circular buffer
+//!
+//! The sequence may wrap past the end of the buffer.
+//!
+//! \param buffer Beginning of the circular buffer
+//! \param size Size of the circular buffer
+//! \param offset Offset of the beginning of the sequence in the circular buffer
+//! \related segmented_iterator
+inline segmented_iterator make_ring_iterator(byte_t *buffer, std::size_t size, std::size_t offset) {
+  return segmented_iterator{buffer + offset, size - offset, buffer, offset};
+}
+
+} // namespace upd
@@ -0,0 +1,134 @@
+//! \file
+
+#pragma once
+
+#include "action.hpp"
+#include "detail/io/immediate_process.hpp"
+#include "detail/static_error.hpp"
+#include "detail/type_traits/input_tuple.hpp"
+#include "detail/type_traits/is_keyring.hpp"
+#include "detail/type_traits/require.hpp"
+#include "format.hpp"
+#include "tuple.hpp"
+#include "typelist.hpp"
+#include "unevaluated.hpp" // IWYU pragma: keep
+#include "upd.hpp"
+
+// IWYU pragma: no_forward_declare unevaluated
+
+namespace upd {
+namespace detail {
+
+//! \brief Invoke the callback `Ftor` on the arguments unserialized from `src` and write its return value to `dest`
+//!
+//! Unlike the actions held by \ref<dispatcher> dispatcher instances, neither the callback nor the byte streams are
+//! type-erased, so the whole call can be inlined in this function.
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         typename F,
+         F Ftor,
+         typename Src,
+         typename Dest>
+void call_static(Src &src, Dest &dest) {
+  call<input_tuple<Endianess, Signed_Mode, F>, Integer_Encoding>(src, dest, Ftor);
+}
+
+} // namespace detail
+
+//! \brief Dispatcher whose actions are resolved at compile time
+//!
+//! When every callback of a keyring is known at compile time (which is always the case with `policy::weak_reference`),
+//! the actions do not need to be stored. A \ref<static_dispatcher> static_dispatcher instance is empty: for each pair
+//! of byte getter and byte putter types, a table of functions indexed by the action index is generated at compile time
+//! and placed in read-only memory. Each of these functions reads the arguments, invokes the callback and writes the
+//! return value without going through any function pointer or virtual function, so that the callback can be inlined.
+//! Therefore, a request is processed with a single indirect call.
+//!
+//! Since the actions are fixed, they cannot be replaced as with \ref<dispatcher> dispatcher instances.
+//!
+//! \tparam Keyring Keyring describing the actions to dispatch
+template<typename Keyring>
+class static_dispatcher
+    : public detail::immediate_process<static_dispatcher<Keyring>, typename Keyring::index_t> {
+  static_assert(detail::is_keyring<Keyring>::value, UPD_ERROR_NOT_KEYRING(Keyring));
+
+public:
+  //! \copydoc keyring::signatures_t
+  using signatures_t = typename Keyring::signatures_t;
+
+  //! \copydoc keyring::index_t
+  using index_t = typename Keyring::index_t;
+
+  using keyring_t = Keyring;
+
+  //! \copydoc keyring::size
+  constexpr static auto size = Keyring::size;
+
+  //! \copydoc keyring::endianess
+  constexpr static auto endianess = Keyring::endianess;
+
+  //!  \copydoc keyring::signed_mode
+  constexpr static auto signed_mode = Keyring::signed_mode;
+
+  //! \copydoc keyring::integer_encoding
+  constexpr static auto integer_encoding = Keyring::integer_encoding;
+
+  //! \brief Construct the object from the provided keyring
+  constexpr explicit static_dispatcher(Keyring) {}
+
+  //! \copybrief static_dispatcher::static_dispatcher
+  constexpr static_dispatcher() = default;
+
+  using detail::immediate_process<static_dispatcher<Keyring>, index_t>::operator();
+
+  //! \brief Extract an index from a byte sequence then invoke the action with that index
+  //!
+  //! The parameters for the action call are extracted from `src` and the return value is inserted into `dest`.
+  //! \copydoc ImmediateProcess_CRTP
+  //!
+  //! \param src Byte getter
+  //! \param dest Byte putter
+  //! \return the index of the called action
+  template<typename Src, typename Dest, UPD_REQUIREMENT(input_invocable, Src), UPD_REQUIREMENT(output_invocable, Dest)>
+  index_t operator()(Src &&src, Dest &&dest) const {
+    auto index = get_index(src);
+
+    if (index < size)
+      call(index, src, dest, typename Keyring::flist_t{});
+
+    return index;
+  }
+
+  //! \brief Extract an index from a byte sequence
+  //! \param src Byte getter
+  //! \return The extracted index
+  template<typename Src, UPD_REQUIREMENT(input_invocable, Src)>
+  index_t get_index(Src &&src) const {
+    tuple<endianess, signed_mode, index_t> index_tuple{uninitialized};
+
+    for (auto &byte : index_tuple)
+      byte = src();
+
+    return get<0>(index_tuple);
+  }
+
+private:
+  template<typename Src, typename Dest, typename... Fs, Fs... Ftors>
+  static void call(index_t index, Src &src, Dest &dest, flist_t<unevaluated<Fs, Ftors>...>) {
+    using handler_t = void (*)(Src &, Dest &);
+
+    constexpr static handler_t handlers[] = {
+        &detail::call_static<endianess, signed_mode, integer_encoding, Fs, Ftors, Src, Dest>...};
+    handlers[index](src, dest);
+  }
+};
+
+//! \brief Make a static dispatcher
+//! \related static_dispatcher
+template<typename Keyring>
+constexpr static_dispatcher<Keyring> make_static_dispatcher(Keyring) {
+  return static_dispatcher<Keyring>{};
+}
+
+} // namespace upd
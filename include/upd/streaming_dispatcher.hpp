@@ -0,0 +1,585 @@
+//! \file
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "action.hpp"
+#include "buffered_dispatcher.hpp"
+#include "format.hpp"
+#include "tuple.hpp"
+#include "typelist.hpp"
+#include "unevaluated.hpp" // IWYU pragma: keep
+#include "upd.hpp"
+
+#include "detail/encoding.hpp"
+#include "detail/io/byte_stream.hpp"
+#include "detail/io/immediate_process.hpp"
+#include "detail/io/immediate_reader.hpp"
+#include "detail/io/immediate_writer.hpp"
+#include "detail/serialization.hpp"
+#include "detail/static_error.hpp"
+#include "detail/type_traits/is_keyring.hpp"
+#include "detail/type_traits/remove_cv_ref.hpp"
+#include "detail/type_traits/require.hpp"
+#include "detail/type_traits/signature.hpp"
+#include "detail/type_traits/ternary.hpp"
+#include "detail/type_traits/typelist.hpp"
+
+// IWYU pragma: no_forward_declare unevaluated
+
+namespace upd {
+namespace detail {
+
+//! \brief Split a parameter pack into its last element (`last_t`) and the typelist of the preceding ones (`leading_t`)
+template<typename Leading, typename... Ts>
+struct split_last;
+template<typename... Ls, typename T>
+struct split_last<tlist_t<Ls...>, T> {
+  using leading_t = tlist_t<Ls...>;
+  using last_t = T;
+};
+template<typename... Ls, typename T, typename U, typename... Ts>
+struct split_last<tlist_t<Ls...>, T, U, Ts...> : split_last<tlist_t<Ls..., T>, U, Ts...> {};
+
+//! \name
+//! \brief Implementation of `stream_layout`, given the parameters preceding the last one and the last one
+//! @{
+
+template<std::size_t Chunk_Length, typename Leading, typename Last>
+struct stream_layout_impl : std::false_type {
+  using header_t = push_back<Leading, Last>;
+  using element_t = byte_t;
+  constexpr static std::size_t length = 0;
+};
+template<std::size_t Chunk_Length, typename Leading, typename T, std::size_t N>
+struct stream_layout_impl<Chunk_Length, Leading, T[N]> : std::integral_constant<bool, (N > Chunk_Length)> {
+  using header_t = ternary_t<(N > Chunk_Length), Leading, push_back<Leading, T[N]>>;
+  using element_t = T;
+  constexpr static std::size_t length = N;
+};
+template<std::size_t Chunk_Length, typename Leading, typename T, std::size_t N>
+struct stream_layout_impl<Chunk_Length, Leading, std::array<T, N>>
+    : std::integral_constant<bool, (N > Chunk_Length)> {
+  using header_t = ternary_t<(N > Chunk_Length), Leading, push_back<Leading, std::array<T, N>>>;
+  using element_t = T;
+  constexpr static std::size_t length = N;
+};
+
+//! @}
+
+//! \name
+//! \brief Describe how the action requests for a callback of type `F` are received by a streaming dispatcher
+//!
+//! If the last parameter of `F` is an array (C-style or `std::array` instance) of more than `Chunk_Length` elements,
+//! `value` is `true`: the preceding parameters (the header, listed in `header_t`) are received as a whole, then the
+//! `length` elements of the array (of type `element_t`) are received by chunks. Otherwise, every parameter belongs to
+//! the header.
+//! @{
+
+template<std::size_t Chunk_Length, typename F>
+struct stream_layout : stream_layout<Chunk_Length, signature_t<F>> {};
+template<std::size_t Chunk_Length, typename R>
+struct stream_layout<Chunk_Length, R()> : std::false_type {
+  using header_t = tlist_t<>;
+  using element_t = byte_t;
+  constexpr static std::size_t length = 0;
+};
+template<std::size_t Chunk_Length, typename R, typename... Args>
+struct stream_layout<Chunk_Length, R(Args...)>
+    : stream_layout_impl<Chunk_Length,
+                         typename split_last<tlist_t<>, remove_cv_ref_t<Args>...>::leading_t,
+                         typename split_last<tlist_t<>, remove_cv_ref_t<Args>...>::last_t> {};
+
+//! @}
+
+//! \brief Maximum number of bytes occupied by instances of the types in a typelist when encoded as requested
+template<integer_encoding Integer_Encoding, typename>
+struct encoded_list_size;
+template<integer_encoding Integer_Encoding, typename... Ts>
+struct encoded_list_size<Integer_Encoding, tlist_t<Ts...>> : sum<tlist_t<encoded_size<Integer_Encoding, Ts>...>> {};
+
+//! \brief Number of bytes needed by a streaming dispatcher to receive the action requests for a callback of type `F`
+//!
+//! The header is received as a whole. A chunk holds the elements already received laid out as in a tuple storage,
+//! followed by the encoding of the element being received.
+template<integer_encoding Integer_Encoding,
+         std::size_t Chunk_Length,
+         typename F,
+         typename Layout = stream_layout<Chunk_Length, F>>
+struct stream_buffer_size
+    : max_p<encoded_list_size<Integer_Encoding, typename Layout::header_t>,
+            std::integral_constant<std::size_t,
+                                   Layout::value ? (Chunk_Length - 1) *
+                                                           serialization_size<typename Layout::element_t>::value +
+                                                       encoded_size<Integer_Encoding, typename Layout::element_t>::value
+                                                 : 0>> {};
+
+//! \brief Map `stream_buffer_size` over a typelist of invocable types
+template<integer_encoding, std::size_t, typename>
+struct map_stream_buffer_size;
+template<integer_encoding Integer_Encoding, std::size_t Chunk_Length, typename... Fs>
+struct map_stream_buffer_size<Integer_Encoding, Chunk_Length, tlist_t<Fs...>>
+    : tlist_t<stream_buffer_size<Integer_Encoding, Chunk_Length, Fs>...> {};
+
+//! \brief Operations of a streaming dispatcher which depend on the action being received
+struct stream_operations {
+  //! \brief Indicates whether the last parameter is received by chunks
+  bool is_streamed;
+
+  //! \brief Number of elements of the last parameter (if it is received by chunks)
+  std::size_t length;
+
+  //! \brief Size of an element of the last parameter laid out in a tuple storage
+  std::size_t element_size;
+
+  //! \brief Length of the header, given its `size` first bytes (see `fields_length`)
+  std::size_t (*header_length)(const byte_t *, std::size_t);
+
+  //! \brief Length of the encoding of an element, given its `size` first bytes (see `fields_length`)
+  std::size_t (*element_length)(const byte_t *, std::size_t);
+
+  //! \brief Lay out a received element as in a tuple storage, in place
+  void (*decode_element)(byte_t *);
+
+  //! \brief Invoke the callback on a header holding every parameter, write the response and return its length
+  std::size_t (*call)(const byte_t *, byte_t *);
+};
+
+//! \brief Implementation of the operations of a streaming dispatcher for the callback `Ftor`
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         std::size_t Chunk_Length,
+         typename F,
+         F Ftor>
+struct streamed_action {
+  using layout_t = stream_layout<Chunk_Length, F>;
+  using element_t = typename layout_t::element_t;
+
+  constexpr static stream_operations make_operations() {
+    return {layout_t::value,
+            layout_t::length,
+            serialization_size<element_t>::value,
+            &header_length,
+            &element_length,
+            &decode_element,
+            &call};
+  }
+
+  static std::size_t header_length(const byte_t *payload, std::size_t size) {
+    return header_length(payload, size, typename layout_t::header_t{});
+  }
+  template<typename... Ts>
+  static std::size_t header_length(const byte_t *payload, std::size_t size, tlist_t<Ts...>) {
+    return fields_length<Integer_Encoding, Endianess, Signed_Mode, Ts...>(payload, size);
+  }
+
+  static std::size_t element_length(const byte_t *payload, std::size_t size) {
+    return skip_field<Integer_Encoding, Endianess, Signed_Mode, element_t>(payload, size, 0);
+  }
+
+  static void decode_element(byte_t *element) {
+    if (is_verbatim_field<Integer_Encoding, element_t>::value)
+      return;
+
+    byte_t decoded[serialization_size<element_t>::value];
+    iterator_reader<const byte_t *> src{element};
+    read_field<Integer_Encoding, Endianess, Signed_Mode, element_t>(decoded, src);
+    std::copy(decoded, decoded + sizeof decoded, element);
+  }
+
+  static std::size_t call(const byte_t *header, byte_t *output) {
+    return call(header, output, std::integral_constant<bool, layout_t::value>{});
+  }
+  static std::size_t call(const byte_t *, byte_t *, std::true_type) { return 0; }
+  static std::size_t call(const byte_t *header, byte_t *output, std::false_type) {
+    iterator_reader<const byte_t *> src{header};
+    iterator_writer<byte_t *> dest{output};
+    detail::call<input_tuple<Endianess, Signed_Mode, F>, Integer_Encoding>(src, dest, Ftor);
+    return std::size_t(dest.it - output);
+  }
+};
+
+//! \brief Reference to the object receiving the action requests for a callback whose last parameter is streamed
+//!
+//! The object is type-erased so that no dynamic allocation is needed. If `object` is null, no object is registered.
+struct stream_handler_ref {
+  void *object;
+  void (*begin)(void *, const byte_t *);
+  void (*chunk)(void *, const byte_t *, std::size_t);
+  std::size_t (*end)(void *, byte_t *);
+};
+
+//! \brief Invoke the `begin` member function of a stream handler on the parameters listed in `Header`
+template<typename Handler, typename Header>
+struct begin_caller;
+template<typename Handler, typename... Ts>
+struct begin_caller<Handler, tlist_t<Ts...>> {
+  void operator()(const Ts &...args) const { handler.begin(args...); }
+
+  Handler &handler;
+};
+
+//! \brief Implementation of `stream_handler_ref` for handlers of type `Handler` receiving the action requests for a
+//! callback of type `F`
+template<endianess Endianess,
+         signed_mode Signed_Mode,
+         integer_encoding Integer_Encoding,
+         std::size_t Chunk_Length,
+         typename F,
+         typename Handler>
+struct stream_handler_model {
+  using layout_t = stream_layout<Chunk_Length, F>;
+  using element_t = typename layout_t::element_t;
+  using return_type_t = remove_cv_ref_t<return_t<F>>;
+
+  static stream_handler_ref make(Handler &handler) { return {&handler, &begin, &chunk, &end}; }
+
+  static void begin(void *handler, const byte_t *header) {
+    begin(*static_cast<Handler *>(handler), header, typename layout_t::header_t{});
+  }
+  static void begin(Handler &handler, const byte_t *, tlist_t<>) { handler.begin(); }
+  template<typename T, typename... Ts>
+  static void begin(Handler &handler, const byte_t *header, tlist_t<T, Ts...>) {
+    tuple<Endianess, Signed_Mode, T, Ts...> args{uninitialized};
+    iterator_reader<const byte_t *> src{header};
+    read_fields<Integer_Encoding>(args, src);
+    args.invoke(begin_caller<Handler, tlist_t<T, Ts...>>{handler});
+  }
+
+  static void chunk(void *handler, const byte_t *elements, std::size_t count) {
+    element_t values[Chunk_Length];
+    read_n_as<Endianess, Signed_Mode>(elements, values, count);
+    static_cast<Handler *>(handler)->chunk(static_cast<const element_t *>(values), count);
+  }
+
+  static std::size_t end(void *handler, byte_t *output) {
+    return end(*static_cast<Handler *>(handler), output, std::is_void<return_type_t>{});
+  }
+  static std::size_t end(Handler &handler, byte_t *, std::true_type) {
+    handler.end();
+    return 0;
+  }
+  static std::size_t end(Handler &handler, byte_t *output, std::false_type) {
+    iterator_writer<byte_t *> dest{output};
+    insert<Endianess, Signed_Mode, Integer_Encoding, return_type_t>(dest, handler.end());
+    return std::size_t(dest.it - output);
+  }
+};
+
+} // namespace detail
+
+//! \brief Dispatcher decoding action requests as their bytes are received, without buffering large arrays
+//!
+//! Buffered dispatchers hold a whole action request before invoking the callback, so their input buffer is as large
+//! as the longest request. A single callback taking a large array (such as a firmware chunk) therefore increases the
+//! memory footprint of the dispatcher, even if the other requests are a few bytes long.
+//!
+//! A streaming dispatcher receives the requests byte after byte as a buffered dispatcher, but when the last parameter
+//! of a callback is an array of more than `Chunk_Length` elements, that array is never held as a whole. The request is
+//! then handled by an object registered with `set_handler()` instead of the callback. This object must define the
+//! following member functions, which are called in that order:
+//!   - `begin(const Args &...)`, called on the other parameters as soon as they are received,
+//!   - `chunk(const T *elements, std::size_t count)`, called on every `Chunk_Length` elements of the array (and on the
+//!   remaining elements at the end of the array),
+//!   - `end()`, called once the whole array has been received, whose return value is the response to the request.
+//!
+//! The other requests are handled by the callbacks of the keyring, as with a \ref<static_dispatcher> static_dispatcher
+//! instance. The input buffer only needs to hold the longest of these requests, the parameters preceding the streamed
+//! arrays and `Chunk_Length` elements of these arrays. Unlike buffered dispatchers, the output buffer only needs to
+//! hold the longest response. The elements of a chunk are unserialized in a temporary array on the stack before
+//! `chunk` is called.
+//!
+//! \code
+//! void upload(std::uint32_t offset, const upd::byte_t (&data)[1024]);
+//!
+//! struct flash_writer {
+//!   void begin(std::uint32_t offset);
+//!   void chunk(const upd::byte_t *data, std::size_t size);
+//!   void end();
+//! } writer;
+//!
+//! auto dispatcher = upd::make_streaming_dispatcher<32>(keyring);
+//! dispatcher.set_handler<decltype(keyring.get(UPD_CTREF(upload)))::index>(writer);
+//! \endcode
+//!
+//! \tparam Keyring Keyring describing the actions to dispatch
+//! \tparam Chunk_Length Maximum number of array elements held at once
+template<typename Keyring, std::size_t Chunk_Length>
+class streaming_dispatcher
+    : public detail::immediate_reader<streaming_dispatcher<Keyring, Chunk_Length>, packet_status>,
+      public detail::immediate_writer<streaming_dispatcher<Keyring, Chunk_Length>>,
+      public detail::immediate_process<streaming_dispatcher<Keyring, Chunk_Length>, packet_status> {
+  static_assert(detail::is_keyring<Keyring>::value, UPD_ERROR_NOT_KEYRING(Keyring));
+  static_assert(Chunk_Length > 0, "Chunks must hold at least one element");
+
+  using this_t = streaming_dispatcher<Keyring, Chunk_Length>;
+
+public:
+  //! \copydoc keyring::signatures_t
+  using signatures_t = typename Keyring::signatures_t;
+
+  //! \copydoc keyring::index_t
+  using index_t = typename Keyring::index_t;
+
+  using keyring_t = Keyring;
+
+  //! \copydoc keyring::size
+  constexpr static auto size = Keyring::size;
+
+  //! \copydoc keyring::endianess
+  constexpr static auto endianess = Keyring::endianess;
+
+  //!  \copydoc keyring::signed_mode
+  constexpr static auto signed_mode = Keyring::signed_mode;
+
+  //! \copydoc keyring::integer_encoding
+  constexpr static auto integer_encoding = Keyring::integer_encoding;
+
+  //! \brief Equals the size of the input buffer
+  constexpr static auto input_buffer_size = detail::max_p<
+      std::integral_constant<std::size_t, sizeof(index_t)>,
+      detail::max<detail::map_stream_buffer_size<integer_encoding, Chunk_Length, typename signatures_t::type>>>::value;
+
+  //! \brief Equals the size of the output buffer (at least one byte, even if every callback returns `void`)
+  constexpr static auto output_buffer_size = detail::max_p<
+      std::integral_constant<std::size_t, 1>,
+      detail::max<detail::map_encoded_return_type_size<integer_encoding, typename signatures_t::type>>>::value;
+
+  //! \brief Construct the object from the provided keyring
+  explicit streaming_dispatcher(Keyring) : streaming_dispatcher{} {}
+
+  //! \copybrief streaming_dispatcher::streaming_dispatcher
+  streaming_dispatcher()
+      : m_handlers{}, m_stage{loading_stage::INDEX}, m_index{0}, m_load_count{sizeof(index_t)}, m_ibuf_next{0},
+        m_chunk_count{0}, m_remaining{0}, m_obuf_next{0}, m_obuf_bottom{0} {}
+
+  //! \brief Register the object receiving the action requests for the callback with the given index
+  //!
+  //! The last parameter of the callback must be an array of more than `Chunk_Length` elements. The object is held by
+  //! reference. Until an object is registered, the requests for that callback are received then dropped.
+  //!
+  //! \tparam Index Index of the callback
+  //! \param handler Object defining the `begin`, `chunk` and `end` member functions
+  template<index_t Index, typename Handler>
+  void set_handler(Handler &handler) {
+    using f_t = detail::at<signatures_t, Index>;
+    static_assert(detail::stream_layout<Chunk_Length, f_t>::value,
+                  "The last parameter of the callback must be an array of more than `Chunk_Length` elements");
+
+    m_handlers[Index] =
+        detail::stream_handler_model<endianess, signed_mode, integer_encoding, Chunk_Length, f_t, Handler>::make(
+            handler);
+  }
+
+  //! \copydoc buffered_dispatcher::is_loaded
+  bool is_loaded() const { return m_obuf_next != m_obuf_bottom; }
+
+  using detail::immediate_reader<this_t, packet_status>::read_from;
+
+  //! \brief Put bytes into the dispatcher until an action request has been fully received
+  //! \copydoc ImmediateReader_CRTP
+  //! \param src Byte getter
+  //! \return one of the following :
+  //!   - packet_status::DROPPED_PACKET: The received index was invalid, or no object was registered for the streamed
+  //!   request which has been received.
+  //!   - packet_status::RESOLVED_PACKET: The request has been fully received and the output buffer contains the
+  //!   response.
+  template<typename Src, UPD_REQUIREMENT(input_invocable, Src)>
+  packet_status read_from(Src &&src) {
+    packet_status status;
+    do
+      status = put(src());
+    while (status == packet_status::LOADING_PACKET);
+
+    return status;
+  }
+
+  UPD_SFINAE_FAILURE_MEMBER(read_from, UPD_ERROR_NOT_INPUT(src))
+
+  //! \brief Put one byte into the dispatcher
+  //!
+  //! The fields are decoded as soon as they are complete, and the `begin`, `chunk` and `end` member functions of the
+  //! registered objects are called from this function.
+  //!
+  //! \copydoc Reader_CRTP
+  //! \param byte Byte to put
+  //! \return one of the following :
+  //!   - packet_status::LOADING_PACKET: The request is not yet fully received.
+  //!   - packet_status::DROPPED_PACKET: The received index was invalid, or no object was registered for the streamed
+  //!   request which has been received.
+  //!   - packet_status::RESOLVED_PACKET: The request has been fully received and the output buffer contains the
+  //!   response.
+  packet_status put(byte_t byte) {
+    m_ibuf[m_ibuf_next++] = byte;
+    return --m_load_count > 0 ? packet_status::LOADING_PACKET : advance();
+  }
+
+  using detail::immediate_writer<this_t>::write_to;
+
+  //! \copydoc buffered_dispatcher::write_to
+  template<typename Dest, UPD_REQUIREMENT(output_invocable, Dest)>
+  void write_to(Dest &&dest) {
+    detail::write_bytes(dest, m_obuf + m_obuf_next, m_obuf_bottom - m_obuf_next);
+    m_obuf_next = m_obuf_bottom;
+  }
+
+  UPD_SFINAE_FAILURE_MEMBER(write_to, UPD_ERROR_NOT_OUTPUT(dest))
+
+  //! \copydoc buffered_dispatcher::get
+  byte_t get() { return is_loaded() ? m_obuf[m_obuf_next++] : byte_t{}; }
+
+  using detail::immediate_process<this_t, packet_status>::operator();
+
+  //! \brief Call read_from() then write_to()
+  //!
+  //! write_to() is called if and only the output buffer has been populated by read_from().
+  //! \copydoc ImmediateProcess_CRTP
+  //!
+  //! \param src Byte getter
+  //! \param dest Byte putter
+  //! \return the \ref<packet_status> enumerator instance resulting from the read_from() call
+  template<typename Src, typename Dest, UPD_REQUIREMENT(input_invocable, Src), UPD_REQUIREMENT(output_invocable, Dest)>
+  packet_status operator()(Src &&src, Dest &&dest) {
+    auto status = read_from(UPD_FWD(src));
+    if (status == packet_status::RESOLVED_PACKET)
+      write_to(UPD_FWD(dest));
+    return status;
+  }
+
+private:
+  //! \brief Part of the action request being received
+  enum class loading_stage { INDEX, HEADER, ARRAY };
+
+  //! \brief Update the state of the dispatcher once the requested bytes have been received
+  //! \return the status of the request being received
+  packet_status advance() {
+    switch (m_stage) {
+    case loading_stage::INDEX:
+      return load_index();
+    case loading_stage::HEADER:
+      return load_header();
+    default:
+      return load_element();
+    }
+  }
+
+  //! \brief Check the received index and start receiving the header
+  packet_status load_index() {
+    auto index = detail::read_as<index_t, endianess, signed_mode>(static_cast<const byte_t *>(m_ibuf));
+    m_ibuf_next = 0;
+
+    if (!(index < size)) {
+      m_load_count = sizeof(index_t);
+      return packet_status::DROPPED_PACKET;
+    }
+
+    m_index = index;
+    m_stage = loading_stage::HEADER;
+    return load_header();
+  }
+
+  //! \brief Invoke the callback or start receiving the streamed array if the header is complete
+  packet_status load_header() {
+    const auto &ops = operations(m_index);
+    auto length = ops.header_length(m_ibuf, m_ibuf_next);
+    if (length > m_ibuf_next) {
+      m_load_count = length - m_ibuf_next;
+      return packet_status::LOADING_PACKET;
+    }
+
+    if (!ops.is_streamed) {
+      reset();
+      return respond(ops.call(m_ibuf, m_obuf));
+    }
+
+    const auto &handler = m_handlers[m_index];
+    if (handler.object)
+      handler.begin(handler.object, m_ibuf);
+
+    m_stage = loading_stage::ARRAY;
+    m_ibuf_next = 0;
+    m_chunk_count = 0;
+    m_remaining = ops.length;
+    m_load_count = ops.element_length(m_ibuf, 0);
+    return packet_status::LOADING_PACKET;
+  }
+
+  //! \brief Decode the element being received if it is complete and pass the chunk on once it is full
+  packet_status load_element() {
+    const auto &ops = operations(m_index);
+    auto *element = m_ibuf + m_chunk_count * ops.element_size;
+    auto received = std::size_t(m_ibuf + m_ibuf_next - element);
+    auto length = ops.element_length(element, received);
+    if (length > received) {
+      m_load_count = length - received;
+      return packet_status::LOADING_PACKET;
+    }
+
+    ops.decode_element(element);
+    m_ibuf_next = ++m_chunk_count * ops.element_size;
+    m_remaining--;
+
+    const auto &handler = m_handlers[m_index];
+    if (m_chunk_count == Chunk_Length || m_remaining == 0) {
+      if (handler.object)
+        handler.chunk(handler.object, m_ibuf, m_chunk_count);
+      m_chunk_count = 0;
+      m_ibuf_next = 0;
+    }
+
+    if (m_remaining > 0) {
+      m_load_count = ops.element_length(m_ibuf + m_ibuf_next, 0);
+      return packet_status::LOADING_PACKET;
+    }
+
+    reset();
+    return handler.object ? respond(handler.end(handler.object, m_obuf)) : packet_status::DROPPED_PACKET;
+  }
+
+  //! \brief Make the output buffer hold the `length` first bytes written into it
+  packet_status respond(std::size_t length) {
+    m_obuf_next = 0;
+    m_obuf_bottom = length;
+    return packet_status::RESOLVED_PACKET;
+  }
+
+  //! \brief Get ready to receive the next action request
+  void reset() {
+    m_stage = loading_stage::INDEX;
+    m_load_count = sizeof(index_t);
+    m_ibuf_next = 0;
+  }
+
+  //! \brief Operations depending on the action with the given index
+  static const detail::stream_operations &operations(index_t index) {
+    return operations(index, typename Keyring::flist_t{});
+  }
+  template<typename... Fs, Fs... Ftors>
+  static const detail::stream_operations &operations(index_t index, flist_t<unevaluated<Fs, Ftors>...>) {
+    constexpr static detail::stream_operations table[] = {
+        detail::streamed_action<endianess, signed_mode, integer_encoding, Chunk_Length, Fs, Ftors>::
+            make_operations()...};
+    return table[index];
+  }
+
+  detail::stream_handler_ref m_handlers[size];
+  loading_stage m_stage;
+  index_t m_index;
+  std::size_t m_load_count, m_ibuf_next, m_chunk_count, m_remaining, m_obuf_next, m_obuf_bottom;
+  byte_t m_ibuf[input_buffer_size], m_obuf[output_buffer_size];
+};
+
+//! \brief Make a streaming dispatcher
+//! \tparam Chunk_Length Maximum number of array elements held at once
+//! \related streaming_dispatcher
+template<std::size_t Chunk_Length, typename Keyring>
+streaming_dispatcher<Keyring, Chunk_Length> make_streaming_dispatcher(Keyring) {
+  return streaming_dispatcher<Keyring, Chunk_Length>{};
+}
+
+} // namespace upd
@@ -9,6 +9,8 @@
 #include "detail/serialization.hpp"
 #include "detail/type_traits/conjunction.hpp"
 #include "detail/type_traits/index_sequence.hpp"
+#include "detail/type_traits/iterator_category.hpp"
+#include "detail/type_traits/remove_cv_ref.hpp"
 #include "detail/type_traits/require.hpp"
 #include "detail/type_traits/signature.hpp"
 #include "detail/type_traits/typelist.hpp"
@@ -22,6 +24,14 @@ namespace upd {
 template<typename, endianess, signed_mode, typename...>
 class tuple_view;
 
+//! \brief Tag type selecting the \ref<tuple> tuple constructor which leaves the internal storage uninitialized
+struct uninitialized_t {
+  explicit uninitialized_t() = default;
+};
+
+//! \brief Instance of \ref<uninitialized_t> uninitialized_t
+constexpr uninitialized_t uninitialized{};
+
 namespace detail {
 
 template<typename, endianess, signed_mode, typename...>
@@ -49,23 +59,6 @@ T &&normalize(T &&x) {
 
 //! @}
 
-//! \brief Return the size in bytes occupied by the serialization of instances of the provided type (if serializable)
-template<typename T, detail::require_is_serializable<T> = 0>
-constexpr std::size_t serialization_size_impl(...) {
-  return sizeof(T);
-}
-template<typename T, detail::require_is_user_serializable<T> = 0>
-constexpr std::size_t serialization_size_impl(int) {
-  return decltype(make_view_for<endianess::LITTLE, signed_mode::TWOS_COMPLEMENT>(
-      (byte_t *)nullptr, examine_invocable<decltype(upd_extension<T>::unserialize)>{}))::size;
-}
-
-//! \brief Return the size in bytes occupied by the serialization of instances of the provided type (if serializable)
-template<typename T>
-struct serialization_size {
-  constexpr static auto value = serialization_size_impl<T>(0);
-};
-
 //! \brief Make a tuple view according to a typelist
 template<endianess Endianess, signed_mode Signed_Mode, typename It, typename... Ts>
 auto make_view_from_typelist(const It &it, detail::tlist_t<Ts...>)
@@ -80,8 +73,8 @@ auto make_view_from_typelist(const It &it, detail::tlist_t<Ts...>)
 //! \tparam Ts... Types of the serialized values
 template<typename D, endianess Endianess, signed_mode Signed_Mode, typename... Ts>
 class tuple_base {
-  D &derived() { return static_cast<D &>(*this); }
-  const D &derived() const { return static_cast<const D &>(*this); }
+  UPD_CONSTEXPR17 D &derived() { return static_cast<D &>(*this); }
+  constexpr const D &derived() const { return static_cast<const D &>(*this); }
 
   static_assert(detail::conjunction<std::integral_constant<bool,
                                                            (!std::is_const<Ts>::value && !std::is_volatile<Ts>::value &&
@@ -89,8 +82,8 @@ class tuple_base {
                 "Type parameters cannot be cv-qualified or ref-qualified.");
 
   static_assert(detail::conjunction<detail::is_serializable<Ts>...>::value,
-                "Some of the provided types are not serializable (serializable types are integer types, types with "
-                "user-defined extension and array types of any of these)");
+                "Some of the provided types are not serializable (serializable types are integer types, IEEE 754 "
+                "floating-point types, types with user-defined extension and array types of any of these)");
 
 public:
   //! \brief Typelist holding `Ts...`
@@ -129,7 +122,7 @@ public:
   auto get() const;
 #else
   template<std::size_t I>
-  decltype(read_as<arg_t<I>, Endianess, Signed_Mode>(nullptr)) get() const {
+  UPD_CONSTEXPR17 decltype(read_as<arg_t<I>, Endianess, Signed_Mode>(nullptr)) get() const {
     using detail::clip;
     using detail::sum;
 
@@ -142,7 +135,7 @@ public:
   //! \tparam I Index of the value which will be set
   //! \param value Value to be copied from
   template<std::size_t I>
-  void set(const arg_t<I> &value) {
+  UPD_CONSTEXPR17 void set(const arg_t<I> &value) {
     using detail::clip;
     using detail::sum;
 
@@ -165,10 +158,15 @@ public:
 
 protected:
   //! \brief Serialize values into the object content
+  //!
+  //! If every value is serialized as its object representation and the content is stored contiguously, each value is
+  //! copied with a single `memcpy`, unless the values are laid at compile time.
   template<std::size_t... Is, typename... Args>
-  void lay(detail::index_sequence<Is...>, const Args &...args) {
-    using discard = int[];
-    (void)discard{0, (set<Is>(args), 0)...};
+  UPD_CONSTEXPR17 void lay(detail::index_sequence<Is...> is, const Args &...args) {
+    if (UPD_DETAIL_IS_CONSTANT_EVALUATED())
+      lay_impl(is, std::false_type{}, args...);
+    else
+      lay_impl(is, has_native_layout<decltype(derived().src())>{}, args...);
   }
 
   //! \brief Lay the element of a tuple-like object into the content
@@ -178,11 +176,54 @@ protected:
   }
 
 private:
+  //! \brief Offset in bytes of the `I`-th serialized value
+  template<std::size_t I>
+  using offset_t = detail::sum<detail::clip<sizes_t, 0, I>>;
+
+  //! \brief Indicates whether the content can be accessed as a whole through `Src`
+  //!
+  //! This is the case when the content is stored contiguously and every value in `Ts...` is serialized as its object
+  //! representation.
+  template<typename Src>
+  using has_native_layout = std::integral_constant<
+      bool,
+      sizeof...(Ts) != 0 && detail::is_contiguous_byte_iterator<Src>::value &&
+          detail::conjunction<detail::has_native_representation<Endianess, Signed_Mode, Ts>...>::value>;
+
+  //! \copydoc lay
+  template<std::size_t... Is, typename... Args>
+  UPD_CONSTEXPR17 void lay_impl(detail::index_sequence<Is...>, std::false_type, const Args &...args) {
+    using discard = int[];
+    (void)discard{0, (set<Is>(args), 0)...};
+  }
+
+  //! \copydoc lay
+  template<std::size_t... Is, typename... Args>
+  void lay_impl(detail::index_sequence<Is...>, std::true_type, const Args &...args) {
+    byte_t *sequence = detail::to_byte_pointer(derived().src());
+
+    using discard = int[];
+    (void)discard{0, (detail::write_native<arg_t<Is>>(args, sequence + offset_t<Is>::value), 0)...};
+  }
+
   //! \brief Unserialize the tuple content and forward it as parameters to the provided functor
   template<typename F, std::size_t... Is>
-  detail::return_t<F> invoke_impl(F &&ftor, detail::index_sequence<Is...>) const {
+  detail::return_t<F> invoke_impl(F &&ftor, detail::index_sequence<Is...> is) const {
+    return invoke_impl(UPD_FWD(ftor), is, has_native_layout<decltype(derived().src())>{});
+  }
+
+  //! \copydoc invoke_impl
+  template<typename F, std::size_t... Is>
+  detail::return_t<F> invoke_impl(F &&ftor, detail::index_sequence<Is...>, std::false_type) const {
     return UPD_FWD(ftor)(detail::normalize<Ts>(get<Is>())...);
   }
+
+  //! \copydoc invoke_impl
+  template<typename F, std::size_t... Is>
+  detail::return_t<F> invoke_impl(F &&ftor, detail::index_sequence<Is...>, std::true_type) const {
+    const byte_t *sequence = detail::to_byte_pointer(derived().src());
+    return UPD_FWD(ftor)(detail::normalize<Ts>(detail::read_native<Ts>(sequence + offset_t<Is>::value))...);
+  }
 };
 
 } // namespace detail
@@ -310,51 +351,79 @@ public:
   using base_t::operator=;
 
   //! \brief Initialize the internal storage with default constructed values
-  tuple() : tuple(Ts{}...) {}
+  UPD_CONSTEXPR17 tuple() : tuple(Ts{}...) {}
+
+  //! \brief Leave the internal storage uninitialized
+  //!
+  //! This saves serializing default constructed values when the storage is about to be overwritten anyway, e.g. when
+  //! it is filled byte by byte from a received payload.
+  //!
+  //! \warning Values must not be read from the instance before its storage has been written.
+  explicit tuple(uninitialized_t) {}
 
   //! \brief Serialize the provided values
+  //!
+  //! Since C++17, tuples holding integers can be constructed in constant expressions. The storage is only
+  //! zero-initialized beforehand where constant evaluation requires it, that is during constant evaluation since C++20
+  //! and always in C++17.
+  //!
   //! \param args... Values to be serialized
+#if __cplusplus >= 202002L
+  constexpr explicit tuple(const Ts &...args) {
+    if (UPD_DETAIL_IS_CONSTANT_EVALUATED()) {
+      for (auto &byte : m_storage)
+        byte = 0;
+    }
+    base_t::lay(detail::make_index_sequence<sizeof...(Ts)>{}, args...);
+  }
+#elif __cplusplus >= 201703L
+  constexpr explicit tuple(const Ts &...args) : m_storage{} {
+    base_t::lay(detail::make_index_sequence<sizeof...(Ts)>{}, args...);
+  }
+#else
   explicit tuple(const Ts &...args) { base_t::lay(detail::make_index_sequence<sizeof...(Ts)>{}, args...); }
+#endif // __cplusplus >= 202002L
 
 #if __cplusplus >= 201703L
   //! \brief (C++17) Serialize the provided values
   //!
   //! \tparam Endianess, Signed_Mode Serialization parameters
   //! \param values... Values to be serialized
-  explicit tuple(endianess_h<Endianess>, signed_mode_h<Signed_Mode>, const Ts &...values) : tuple(values...) {}
+  constexpr explicit tuple(endianess_h<Endianess>, signed_mode_h<Signed_Mode>, const Ts &...values)
+      : tuple(values...) {}
 #endif // __cplusplus >= 201703L
 
   //! \brief Beginning of the internal storage
-  byte_t *begin() { return m_storage; }
+  UPD_CONSTEXPR17 byte_t *begin() { return m_storage; }
 
   //! \copydoc begin()
-  const byte_t *begin() const { return m_storage; }
+  constexpr const byte_t *begin() const { return m_storage; }
 
   //! \brief End of the internal storage
-  byte_t *end() { return m_storage + base_t::size; }
+  UPD_CONSTEXPR17 byte_t *end() { return m_storage + base_t::size; }
 
   //! \copydoc end()
-  const byte_t *end() const { return m_storage + base_t::size; }
+  constexpr const byte_t *end() const { return m_storage + base_t::size; }
 
   //! \brief Access the object content
   //!
   //! \warning There is no bound check performed.
   //!
   //! \param i Index of the accessed byte
-  byte_t &operator[](std::size_t i) { return m_storage[i]; }
+  UPD_CONSTEXPR17 byte_t &operator[](std::size_t i) { return m_storage[i]; }
 
   //! \brief Access the object content
   //!
   //! \warning There is no bound check performed.
   //!
   //! \param i Index of the accessed byte
-  const byte_t &operator[](std::size_t i) const { return m_storage[i]; }
+  constexpr const byte_t &operator[](std::size_t i) const { return m_storage[i]; }
 
   //! \copydoc begin()
-  byte_t *src() { return begin(); }
+  UPD_CONSTEXPR17 byte_t *src() { return begin(); }
 
   //! \copydoc begin()
-  const byte_t *src() const { return begin(); }
+  constexpr const byte_t *src() const { return begin(); }
 
   //! \brief Make a view out of a subset of the tuple
   //! \tparam I First element in the view
@@ -401,20 +470,27 @@ private:
 template<endianess Endianess, signed_mode Signed_Mode>
 class tuple<Endianess, Signed_Mode> : public detail::tuple_base<tuple<Endianess, Signed_Mode>, Endianess, Signed_Mode> {
 public:
+  tuple() = default;
+  constexpr explicit tuple(uninitialized_t) {}
+
   constexpr byte_t *begin() const { return nullptr; }
   constexpr byte_t *end() const { return nullptr; }
   constexpr byte_t *src() const { return begin(); }
 };
 
 //! \brief Construct a \ref<tuple> tuple instance from provided values
+//!
+//! The values are taken by forwarding reference so that this overload is preferred over `std::make_tuple` when the
+//! latter is found through argument-dependent lookup (e.g. for `std::array` values).
+//!
 //! \tparam Endianess, Signed_Mode Serialization parameters
 //! \param args... Values to be serialized into the return value
 //! \return a \ref<tuple> tuple instance initialized from `args...`
 //! \related tuple
 template<endianess Endianess, signed_mode Signed_Mode, typename... Args>
-tuple<Endianess, Signed_Mode, Args...>
-make_tuple(endianess_h<Endianess>, signed_mode_h<Signed_Mode>, const Args &...args) {
-  return tuple<Endianess, Signed_Mode, Args...>{args...};
+UPD_CONSTEXPR17 tuple<Endianess, Signed_Mode, detail::remove_cv_ref_t<Args>...>
+make_tuple(endianess_h<Endianess>, signed_mode_h<Signed_Mode>, Args &&...args) {
+  return tuple<Endianess, Signed_Mode, detail::remove_cv_ref_t<Args>...>{args...};
 }
 
 //! \brief Construct a \ref<tuple> tuple instance holding default values
@@ -422,7 +498,7 @@ make_tuple(endianess_h<Endianess>, signed_mode_h<Signed_Mode>, const Args &...ar
 //! \tparam Endianess, Signed_Mode Serialization parameters
 //! \related tuple
 template<typename... Args, endianess Endianess, signed_mode Signed_Mode>
-tuple<Endianess, Signed_Mode, Args...> make_tuple(endianess_h<Endianess>, signed_mode_h<Signed_Mode>) {
+UPD_CONSTEXPR17 tuple<Endianess, Signed_Mode, Args...> make_tuple(endianess_h<Endianess>, signed_mode_h<Signed_Mode>) {
   return tuple<Endianess, Signed_Mode, Args...>{};
 }
 
@@ -0,0 +1,194 @@
+//! \file
+
+#pragma once
+
+#include <cstddef>
+
+#include "detail/serialization.hpp"
+#include "detail/type_traits/typelist.hpp"
+#include "format.hpp"
+#include "tuple.hpp"
+#include "type.hpp"
+#include "typelist.hpp"
+
+namespace upd {
+
+//! \brief Number of records of a \ref<tuple_array> tuple_array instance bound to an external storage
+constexpr std::size_t dynamic_extent = ~std::size_t(0);
+
+namespace detail {
+
+//! \brief Provides the features of \ref<tuple_array> tuple_array to the derived class through CRTP
+//! \tparam D Type of the derived class, which provides `data()` and `size()`
+//! \tparam Endianess, Signed_Mode Serialization parameters
+//! \tparam Ts... Types of the serialized values of each record
+template<typename D, endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+class tuple_array_base {
+  D &derived() { return static_cast<D &>(*this); }
+  const D &derived() const { return static_cast<const D &>(*this); }
+
+  using sizes_t = upd::typelist_t<serialization_size<Ts>...>;
+
+  //! \brief Offset in bytes of the `I`-th serialized value in a record
+  template<std::size_t I>
+  using offset_t = detail::sum<detail::clip<sizes_t, 0, I>>;
+
+public:
+  //! \brief Type of one of the serialized values of a record
+  //! \tparam I Index of the requested type in `Ts...`
+  template<std::size_t I>
+  using arg_t = typename tuple<Endianess, Signed_Mode, Ts...>::template arg_t<I>;
+
+  //! \brief Type of the values of a column (the `std::array` instance corresponding to array types)
+  //! \tparam I Index of the column
+  template<std::size_t I>
+  using column_t = decltype(read_as<arg_t<I>, Endianess, Signed_Mode>(nullptr));
+
+  //! \brief Tuple view bound to a record
+  using record_t = tuple_view<byte_t *, Endianess, Signed_Mode, Ts...>;
+
+  //! \brief Tuple view bound to a record which cannot be modified
+  using const_record_t = tuple_view<const byte_t *, Endianess, Signed_Mode, Ts...>;
+
+  //! \brief Size in bytes of a record
+  constexpr static auto stride = tuple<Endianess, Signed_Mode, Ts...>::size;
+
+  //! \brief Equals the endianess given as template parameter
+  constexpr static auto storage_endianess = Endianess;
+
+  //! \brief Equals the signed mode given as template parameter
+  constexpr static auto storage_signed_mode = Signed_Mode;
+
+  //! \brief Access a record
+  //!
+  //! \warning There is no bound check performed.
+  //!
+  //! \param i Index of the record
+  //! \return a \ref<tuple_view> tuple_view instance bound to the record
+  record_t operator[](std::size_t i) { return record_t{derived().data() + i * stride}; }
+
+  //! \copydoc operator[]
+  const_record_t operator[](std::size_t i) const { return const_record_t{derived().data() + i * stride}; }
+
+  //! \brief Beginning of the storage
+  byte_t *begin() { return derived().data(); }
+
+  //! \copydoc begin()
+  const byte_t *begin() const { return derived().data(); }
+
+  //! \brief End of the storage
+  byte_t *end() { return derived().data() + derived().size() * stride; }
+
+  //! \copydoc end()
+  const byte_t *end() const { return derived().data() + derived().size() * stride; }
+
+  //! \brief Unserialize the `I`-th value of every record
+  //!
+  //! The values are unserialized in a single strided loop rather than record by record.
+  //!
+  //! \tparam I Index of the column
+  //! \param output Array of `size()` values to write into
+  template<std::size_t I>
+  void column(column_t<I> *output) const {
+    read_strided_as<arg_t<I>, Endianess, Signed_Mode>(
+        derived().data() + offset_t<I>::value, stride, output, derived().size());
+  }
+
+  //! \brief Serialize values as the `I`-th value of every record
+  //!
+  //! The values are serialized in a single strided loop rather than record by record.
+  //!
+  //! \tparam I Index of the column
+  //! \param input Array of `size()` values to serialize
+  template<std::size_t I>
+  void assign_column(const column_t<I> *input) {
+    write_strided_as<Endianess, Signed_Mode>(input, derived().data() + offset_t<I>::value, stride, derived().size());
+  }
+};
+
+} // namespace detail
+
+//! \brief Sequence of records serialized back to back
+//!
+//! Each record is laid out as the content of a `tuple<Endianess, Signed_Mode, Ts...>` instance, so records are
+//! `stride` bytes apart. Records can be accessed one by one through \ref<tuple_view> tuple_view instances, but a
+//! value can also be extracted from (or assigned to) every record at once with `column()` and `assign_column()`.
+//!
+//! If `N` is \ref<dynamic_extent> dynamic_extent, the instance does not own its storage and is bound to an external
+//! buffer. Otherwise, it holds the storage for `N` records.
+//!
+//! \code
+//! using namespace upd;
+//!
+//! tuple_array<1000, endianess::LITTLE, signed_mode::TWOS_COMPLEMENT, std::uint32_t, std::int16_t> samples;
+//! std::int16_t values[1000];
+//!
+//! samples.column<1>(values);
+//! \endcode
+//!
+//! \tparam N Number of records
+//! \tparam Endianess, Signed_Mode Serialization parameters
+//! \tparam Ts... Types of the serialized values of each record
+template<std::size_t N, endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+class tuple_array
+    : public detail::tuple_array_base<tuple_array<N, Endianess, Signed_Mode, Ts...>, Endianess, Signed_Mode, Ts...> {
+  using base_t =
+      detail::tuple_array_base<tuple_array<N, Endianess, Signed_Mode, Ts...>, Endianess, Signed_Mode, Ts...>;
+
+public:
+  //! \brief Zero the storage
+  tuple_array() : m_storage{} {}
+
+  //! \brief Pointer to the storage
+  byte_t *data() { return m_storage; }
+
+  //! \copydoc data()
+  const byte_t *data() const { return m_storage; }
+
+  //! \brief Number of records
+  constexpr std::size_t size() const { return N; }
+
+private:
+  byte_t m_storage[N * base_t::stride];
+};
+
+//! \brief Sequence of records serialized back to back in an external buffer
+//! \copydetails tuple_array
+template<endianess Endianess, signed_mode Signed_Mode, typename... Ts>
+class tuple_array<dynamic_extent, Endianess, Signed_Mode, Ts...>
+    : public detail::tuple_array_base<tuple_array<dynamic_extent, Endianess, Signed_Mode, Ts...>,
+                                      Endianess,
+                                      Signed_Mode,
+                                      Ts...> {
+public:
+  //! \brief Bind the instance to an external buffer
+  //! \param storage Beginning of the buffer, which must be at least `count * stride` bytes long
+  //! \param count Number of records
+  tuple_array(byte_t *storage, std::size_t count) : m_storage{storage}, m_count{count} {}
+
+  //! \brief Pointer to the storage
+  byte_t *data() { return m_storage; }
+
+  //! \copydoc data()
+  const byte_t *data() const { return m_storage; }
+
+  //! \brief Number of records
+  std::size_t size() const { return m_count; }
+
+private:
+  byte_t *m_storage;
+  std::size_t m_count;
+};
+
+//! \brief Bind a \ref<tuple_array> tuple_array instance to an external buffer
+//! \tparam Ts... Types of the serialized values of each record
+//! \param storage Beginning of the buffer
+//! \param count Number of records
+//! \related tuple_array
+template<typename... Ts, endianess Endianess, signed_mode Signed_Mode>
+tuple_array<dynamic_extent, Endianess, Signed_Mode, Ts...>
+make_tuple_array(endianess_h<Endianess>, signed_mode_h<Signed_Mode>, byte_t *storage, std::size_t count) {
+  return tuple_array<dynamic_extent, Endianess, Signed_Mode, Ts...>{storage, count};
+}
+
+} // namespace upd
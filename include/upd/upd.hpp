@@ -1,34 +1,100 @@
 #pragma once
 
+#include <type_traits>
+
+#include "detail/type_traits/ternary.hpp"
 #include "format.hpp"
 
+#if __cplusplus >= 202002L && defined(__has_include)
+#if __has_include(<bit>)
+#include <bit>
+#endif // __has_include(<bit>)
+#endif // __cplusplus >= 202002L && defined(__has_include)
+
 #define UPD_FWD(x) static_cast<decltype(x) &&>(x)
 #define UPD_PACK(...) __VA_ARGS__
 #define UPD_SCOPE_OPERATOR(LHS, RHS) LHS::RHS
 
+// Functions which are only `constexpr` since C++17, since they need loops and several statements
+#if __cplusplus >= 201703L
+#define UPD_CONSTEXPR17 constexpr
+#else // __cplusplus >= 201703L
+#define UPD_CONSTEXPR17
+#endif // __cplusplus >= 201703L
+
+// Indicates whether the enclosing function is evaluated at compile time, so that it does not call `memcpy` or other
+// functions which cannot appear in constant expressions. Without compiler support, run-time evaluation is assumed.
+#if __cplusplus >= 201703L && defined(__cpp_lib_is_constant_evaluated)
+#define UPD_DETAIL_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif __cplusplus >= 201703L && (defined(__GNUC__) && __GNUC__ >= 9 || defined(__clang__) && __clang_major__ >= 9)
+#define UPD_DETAIL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define UPD_DETAIL_IS_CONSTANT_EVALUATED() false
+#endif
+
+// Detect the platform endianess if it has not been provided by the user
+#if !defined(UPD_PLATFORM_ENDIANESS)
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define UPD_PLATFORM_ENDIANESS LITTLE
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define UPD_PLATFORM_ENDIANESS BIG
+#elif defined(__cpp_lib_endian)
+#define UPD_DETAIL_STD_ENDIAN
+#endif
+#endif // !defined(UPD_PLATFORM_ENDIANESS)
+
+// Detect the platform signed representation if it has not been provided by the user. Since C++20, signed integers are
+// required to be two's complement. Before that, the preprocessor evaluates `-1 & 3` with the representation of
+// `intmax_t`, which gives away the signed representation.
+#if !defined(UPD_PLATFORM_SIGNED_MODE)
+#if __cplusplus >= 202002L || (-1 & 3) == 3
+#define UPD_PLATFORM_SIGNED_MODE TWOS_COMPLEMENT
+#elif (-1 & 3) == 2
+#define UPD_PLATFORM_SIGNED_MODE ONES_COMPLEMENT
+#elif (-1 & 3) == 1
+#define UPD_PLATFORM_SIGNED_MODE SIGNED_MAGNITUDE
+#endif
+#endif // !defined(UPD_PLATFORM_SIGNED_MODE)
+
 namespace upd {
+namespace detail {
+
+//! \brief Stands for a platform property which could not be determined
+//!
+//! Comparing instances of this class with any value of `T` always yields that they are different.
+template<typename T>
+struct unknown_platform_property {
+  constexpr unknown_platform_property() = default;
+  constexpr unknown_platform_property(T) {}
+
+  constexpr bool operator==(T) const { return false; }
+  constexpr bool operator!=(T) const { return true; }
+};
+
+} // namespace detail
 
-//! \brief Contains the platform-specific information provided by the user
+//! \brief Contains the platform-specific information
 //!
-//! `platform_info.endianess` equals `UPD_PLATFORM_ENDIANESS`.
-//! `platform_info.signed_mode` equals `UPD_PLATFORM_SIGNED_MODE`.
+//! `platform_info.endianess` equals `UPD_PLATFORM_ENDIANESS` and `platform_info.signed_mode` equals
+//! `UPD_PLATFORM_SIGNED_MODE`. If these macros are not defined by the user, they are deduced from the compiler
+//! predefined macros (or from `std::endian` in C++20). If a property cannot be determined, comparing it with any
+//! enumerator yields that they are different, so the platform-agnostic implementations are used.
 constexpr struct {
 #if defined(UPD_PLATFORM_ENDIANESS)
   upd::endianess endianess = UPD_SCOPE_OPERATOR(upd::endianess, UPD_PLATFORM_ENDIANESS);
+#elif defined(UPD_DETAIL_STD_ENDIAN)
+  detail::ternary_t<std::endian::native == std::endian::little || std::endian::native == std::endian::big,
+                    upd::endianess,
+                    detail::unknown_platform_property<upd::endianess>>
+      endianess = std::endian::native == std::endian::little ? upd::endianess::LITTLE : upd::endianess::BIG;
 #else  // defined(UPD_PLATFORM_ENDIANESS)
-  struct {
-    constexpr bool operator==(endianess) const { return false; }
-    constexpr bool operator!=(endianess) const { return true; }
-  } endianess;
+  detail::unknown_platform_property<upd::endianess> endianess;
 #endif // defined(UPD_PLATFORM_ENDIANESS)
 
 #if defined(UPD_PLATFORM_SIGNED_MODE)
   upd::signed_mode signed_mode = UPD_SCOPE_OPERATOR(upd::signed_mode, UPD_PLATFORM_SIGNED_MODE);
 #else  // defined(UPD_PLATFORM_SIGNED_MODE)
-  struct {
-    constexpr bool operator==(signed_mode) const { return false; }
-    constexpr bool operator!=(signed_mode) const { return true; }
-  } signed_mode;
+  detail::unknown_platform_property<upd::signed_mode> signed_mode;
 #endif // defined(UPD_PLATFORM_SIGNED_MODE)
 } platform_info;
 
@@ -1,3 +1,8 @@
+#include <array>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
 #include <upd/action.hpp>
 
 #include "utility.hpp"
@@ -64,6 +69,116 @@ static void action_DO_instantiate_action_with_functor_non_returning_EXPECT_input
   TEST_ASSERT_EQUAL_INT(0, f.output_size());
 }
 
+static void action_DO_call_in_place_on_contiguous_payload_EXPECT_unaltered_arguments() {
+  using namespace upd;
+
+  const int array[] = {0x00, 0x11, 0x22, 0x33};
+  auto serialized_arguments = upd::make_tuple(little_endian, twos_complement, array, short{-4});
+  auto serialized_return_value = upd::make_tuple(little_endian, twos_complement, int{0});
+  action sum{[](const int(&xs)[4], short y) { return xs[0] + xs[1] + xs[2] + xs[3] + y; },
+             upd::little_endian,
+             upd::twos_complement};
+
+  std::size_t i = 0;
+  sum.call_in_place(serialized_arguments.begin(), [&](upd::byte_t byte) { serialized_return_value[i++] = byte; });
+
+  TEST_ASSERT_EQUAL_INT(0x66 - 4, serialized_return_value.get<0>());
+}
+
+static void action_DO_call_in_place_on_varint_payload_EXPECT_unaltered_arguments() {
+  using namespace upd;
+
+  const upd::byte_t payload[] = {0xd8, 0x04, 0x03};
+  int x = 0;
+  short y = 0;
+  action assign{[&](int a, short b) { x = a, y = b; }, upd::little_endian, upd::twos_complement, upd::varint};
+
+  assign.call_in_place(payload, [](upd::byte_t) {});
+
+  TEST_ASSERT_EQUAL_INT(300, x);
+  TEST_ASSERT_EQUAL_INT(-2, y);
+}
+
+static void action_DO_return_std_tuple_EXPECT_every_element_serialized() {
+  using namespace upd;
+
+  auto expected = upd::make_tuple(little_endian, twos_complement, int{-12}, short{34}, bool{true});
+  upd::byte_t response[sizeof(int) + sizeof(short) + sizeof(bool)] = {};
+  action state{[](int x) { return std::make_tuple(x, short{34}, true); }, upd::little_endian, upd::twos_complement};
+  action pair{[]() { return std::make_pair(int{-12}, short{34}); }, upd::little_endian, upd::twos_complement};
+
+  TEST_ASSERT_EQUAL_INT(sizeof response, state.output_size());
+  TEST_ASSERT_EQUAL_INT(sizeof(int) + sizeof(short), pair.output_size());
+
+  auto argument = upd::make_tuple(little_endian, twos_complement, int{-12});
+  std::size_t i = 0, j = 0;
+  state([&]() { return argument[i++]; }, [&](upd::byte_t byte) { response[j++] = byte; });
+
+  TEST_ASSERT_EQUAL_INT(sizeof response, j);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.begin(), response, sizeof response);
+}
+
+static void action_DO_call_on_large_array_through_iterators_EXPECT_unaltered_argument_and_return_value() {
+  using namespace upd;
+
+  static upd::byte_t payload[1024];
+  for (std::size_t i = 0; i < sizeof payload; i++)
+    payload[i] = upd::byte_t(i * 7);
+  upd::byte_t response[sizeof payload] = {};
+  action reverse{[](const upd::byte_t(&xs)[1024]) {
+                   std::array<upd::byte_t, 1024> retval;
+                   for (std::size_t i = 0; i < retval.size(); i++)
+                     retval[i] = xs[retval.size() - 1 - i];
+                   return retval;
+                 },
+                 upd::little_endian,
+                 upd::twos_complement};
+
+  reverse(payload, response);
+
+  for (std::size_t i = 0; i < sizeof payload; i++)
+    TEST_ASSERT_EQUAL_UINT8(payload[sizeof payload - 1 - i], response[i]);
+}
+
+static void action_DO_call_with_bulk_byte_streams_EXPECT_one_call_per_payload() {
+  using namespace upd;
+
+  struct source_t {
+    upd::byte_t operator()() { return byte_count++, *ptr++; }
+    void read(upd::byte_t *output, std::size_t size) { memcpy(output, ptr, size), ptr += size, bulk_count++; }
+
+    const upd::byte_t *ptr;
+    int byte_count, bulk_count;
+  };
+  struct sink_t {
+    void operator()(upd::byte_t byte) { *ptr++ = byte, byte_count++; }
+    void write(const upd::byte_t *input, std::size_t size) { memcpy(ptr, input, size), ptr += size, bulk_count++; }
+
+    upd::byte_t *ptr;
+    int byte_count, bulk_count;
+  };
+
+  const long long array[] = {1, 2, 3, 4, 5, 6, 7, 8};
+  auto serialized_arguments = upd::make_tuple(little_endian, twos_complement, array, short{-4});
+  auto serialized_return_value = upd::make_tuple(little_endian, twos_complement, 0ll, 0ll);
+  action sum{[](const long long(&xs)[8], short y) {
+               return std::make_pair(xs[0] + xs[7] + y, xs[1] + xs[6]);
+             },
+             upd::little_endian,
+             upd::twos_complement};
+
+  source_t src{serialized_arguments.begin(), 0, 0};
+  sink_t dest{serialized_return_value.begin(), 0, 0};
+  sum(src, dest);
+
+  TEST_ASSERT_EQUAL_INT(0, src.byte_count);
+  TEST_ASSERT_EQUAL_INT(1, src.bulk_count);
+  TEST_ASSERT_EQUAL_INT(0, dest.byte_count);
+  TEST_ASSERT_EQUAL_INT(1, dest.bulk_count);
+  TEST_ASSERT_EQUAL_INT(5, serialized_return_value.get<0>());
+  TEST_ASSERT_EQUAL_INT(9, serialized_return_value.get<1>());
+}
+
 int main() {
   using namespace upd;
 
@@ -74,5 +189,10 @@ int main() {
   RUN_TEST(action_DO_instantiate_action_with_functor_taking_no_arguments_EXPECT_input_and_output_sizes_correct);
   RUN_TEST(action_DO_instantiate_action_with_functor_returning_non_tuple_EXPECT_input_and_output_sizes_correct);
   RUN_TEST(action_DO_instantiate_action_with_functor_non_returning_EXPECT_input_and_output_sizes_correct);
+  RUN_TEST(action_DO_call_in_place_on_contiguous_payload_EXPECT_unaltered_arguments);
+  RUN_TEST(action_DO_call_in_place_on_varint_payload_EXPECT_unaltered_arguments);
+  RUN_TEST(action_DO_return_std_tuple_EXPECT_every_element_serialized);
+  RUN_TEST(action_DO_call_on_large_array_through_iterators_EXPECT_unaltered_argument_and_return_value);
+  RUN_TEST(action_DO_call_with_bulk_byte_streams_EXPECT_one_call_per_payload);
   return UNITY_END();
 }
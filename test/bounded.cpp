@@ -0,0 +1,149 @@
+#include <cstring>
+
+#include <upd/bounded.hpp>
+#include <upd/buffered_dispatcher.hpp>
+#include <upd/key.hpp>
+#include <upd/keyring.hpp>
+#include <upd/policy.hpp>
+#include <upd/tuple.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+using text_t = upd::bounded_string<200>;
+using samples_t = upd::bounded_vector<int16_t, 8>;
+
+static std::size_t logged_length;
+
+void log(const text_t &text) { logged_length = text.size(); }
+samples_t reverse(const samples_t &samples) {
+  samples_t retval;
+  for (std::size_t i = samples.size(); i > 0; i--)
+    retval.push_back(samples[i - 1]);
+  return retval;
+}
+
+constexpr auto list = upd::make_flist(UPD_CTREF(log), UPD_CTREF(reverse));
+constexpr auto kring = upd::make_keyring(list, upd::big_endian, upd::twos_complement);
+constexpr auto varint_kring = upd::make_keyring(list, upd::big_endian, upd::twos_complement, upd::varint);
+
+static void bounded_vector_DO_fill_past_capacity_EXPECT_extra_elements_discarded() {
+  upd::bounded_vector<int, 3> v{1, 2, 3, 4};
+
+  TEST_ASSERT_EQUAL_UINT(3, v.size());
+  TEST_ASSERT_TRUE(v.full());
+  TEST_ASSERT_FALSE(v.push_back(5));
+
+  v.pop_back();
+  TEST_ASSERT_TRUE(v.push_back(5));
+  TEST_ASSERT_EQUAL_INT(5, v[2]);
+
+  text_t text = "hello";
+  TEST_ASSERT_EQUAL_UINT(5, text.length());
+  TEST_ASSERT_EQUAL_MEMORY("hello", text.data(), 5);
+}
+
+static void bounded_vector_DO_store_in_tuple_EXPECT_worst_case_storage_and_unaltered_value() {
+  using namespace upd;
+
+  auto t = make_tuple(big_endian, twos_complement, samples_t{-1, 2, 0x1234}, uint8_t{0xaa});
+
+  static_assert(decltype(t)::size == 1 + 8 * 2 + 1, "");
+  TEST_ASSERT_EQUAL_UINT8(3, t[0]);
+  TEST_ASSERT_EQUAL_UINT8(0x12, t[5]);
+  TEST_ASSERT_EQUAL_UINT8(0x34, t[6]);
+  TEST_ASSERT_EQUAL_UINT8(0, t[7]);
+  TEST_ASSERT_EQUAL_UINT8(0xaa, t[17]);
+
+  auto samples = t.get<0>();
+  TEST_ASSERT_TRUE((samples == samples_t{-1, 2, 0x1234}));
+}
+
+static void key_DO_serialize_bounded_string_EXPECT_only_used_characters_sent() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(log));
+  byte_t buf[k.payload_length];
+
+  static_assert(k.payload_length == 1 + 1 + 200, "");
+
+  std::size_t length = 0;
+  k(text_t{"abc"}) >> [&](byte_t byte) { buf[length++] = byte; };
+
+  const byte_t expected[] = {0, 3, 'a', 'b', 'c'};
+  TEST_ASSERT_EQUAL_UINT(sizeof expected, length);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buf, sizeof expected);
+}
+
+static void buffered_dispatcher_DO_put_bounded_requests_byte_by_byte_EXPECT_requests_resolved_at_their_end() {
+  using namespace upd;
+
+  auto dis = make_single_buffered_dispatcher(kring, policy::any_callback);
+  auto k_log = kring.get(UPD_CTREF(log));
+  auto k_reverse = kring.get(UPD_CTREF(reverse));
+  byte_t buf[decltype(dis)::buffer_size];
+
+  static_assert(decltype(dis)::buffer_size == 1 + 1 + 200, "");
+
+  std::size_t length = 0;
+  k_log(text_t{"hi"}) >> [&](byte_t byte) { buf[length++] = byte; };
+  for (std::size_t i = 0; i < length - 1; i++)
+    TEST_ASSERT_EQUAL(packet_status::LOADING_PACKET, dis.put(buf[i]));
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis.put(buf[length - 1]));
+  TEST_ASSERT_EQUAL_UINT(2, logged_length);
+
+  length = 0;
+  k_reverse(samples_t{}) >> [&](byte_t byte) { buf[length++] = byte; };
+  TEST_ASSERT_EQUAL_UINT(2, length);
+  TEST_ASSERT_EQUAL(packet_status::LOADING_PACKET, dis.put(buf[0]));
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis.put(buf[1]));
+  dis >> buf;
+  TEST_ASSERT_TRUE(k_reverse << buf == samples_t{});
+
+  length = 0;
+  k_reverse(samples_t{1, -2, 300}) >> [&](byte_t byte) { buf[length++] = byte; };
+  TEST_ASSERT_EQUAL_UINT(1 + 1 + 3 * 2, length);
+  for (std::size_t i = 0; i < length - 1; i++)
+    TEST_ASSERT_EQUAL(packet_status::LOADING_PACKET, dis.put(buf[i]));
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis.put(buf[length - 1]));
+
+  length = 0;
+  dis >> [&](byte_t byte) { buf[length++] = byte; };
+  TEST_ASSERT_EQUAL_UINT(1 + 3 * 2, length);
+  TEST_ASSERT_TRUE((k_reverse << buf == samples_t{300, -2, 1}));
+}
+
+static void buffered_dispatcher_DO_put_bounded_varint_request_EXPECT_varint_elements() {
+  using namespace upd;
+
+  auto dis = make_double_buffered_dispatcher(varint_kring, policy::any_callback);
+  auto k = varint_kring.get(UPD_CTREF(reverse));
+  byte_t buf[decltype(dis)::input_buffer_size];
+
+  static_assert(decltype(dis)::input_buffer_size == 1 + 1 + 200, "");
+
+  std::size_t length = 0;
+  k(samples_t{1, -2, 300}) >> [&](byte_t byte) { buf[length++] = byte; };
+
+  const byte_t expected[] = {1, 3, 0x02, 0x03, 0xd8, 0x04};
+  TEST_ASSERT_EQUAL_UINT(sizeof expected, length);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buf, sizeof expected);
+
+  for (std::size_t i = 0; i < length - 1; i++)
+    TEST_ASSERT_EQUAL(packet_status::LOADING_PACKET, dis.put(buf[i]));
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis.put(buf[length - 1]));
+
+  auto result = k.read_from([&]() { return dis.get(); });
+  TEST_ASSERT_TRUE((result == samples_t{300, -2, 1}));
+  TEST_ASSERT_FALSE(dis.is_loaded());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(bounded_vector_DO_fill_past_capacity_EXPECT_extra_elements_discarded);
+  RUN_TEST(bounded_vector_DO_store_in_tuple_EXPECT_worst_case_storage_and_unaltered_value);
+  RUN_TEST(key_DO_serialize_bounded_string_EXPECT_only_used_characters_sent);
+  RUN_TEST(buffered_dispatcher_DO_put_bounded_requests_byte_by_byte_EXPECT_requests_resolved_at_their_end);
+  RUN_TEST(buffered_dispatcher_DO_put_bounded_varint_request_EXPECT_varint_elements);
+  return UNITY_END();
+}
@@ -1,3 +1,7 @@
+#include <iterator>
+#include <limits>
+#include <vector>
+
 #include <upd/buffered_dispatcher.hpp>
 #include <upd/keyring.hpp>
 #include <upd/unevaluated.hpp>
@@ -20,6 +24,12 @@ constexpr auto kring =
                       upd::little_endian,
                       upd::twos_complement);
 
+constexpr auto varint_kring =
+    upd::make_keyring(upd::make_flist(UPD_CTREF(check_64), UPD_CTREF(identity), UPD_CTREF(void_procedure)),
+                      upd::little_endian,
+                      upd::twos_complement,
+                      upd::varint);
+
 static upd::action reply_hook;
 
 void reply(const upd::byte_t (&payload)[16]) { reply_hook(std::begin(payload)); }
@@ -283,6 +293,124 @@ static void buffered_dispatcher_DO_use_parenthesis_operator() {
   TEST_ASSERT_EQUAL(64, k.read_from(kbuf));
 }
 
+static void buffered_dispatcher_DO_insert_varint_requests_one_by_one_EXPECT_resolved_on_last_byte() {
+  using namespace upd;
+
+  upd::byte_t kbuf[16];
+  auto dis = make_single_buffered_dispatcher(varint_kring, policy::any_callback);
+  auto k = varint_kring.get(UPD_CTREF(identity));
+
+  static_assert(dis.buffer_size == 10 + sizeof(decltype(dis)::index_t), "");
+
+  const std::int64_t values[] = {-1, 64, std::int64_t{1} << 40, std::numeric_limits<std::int64_t>::min()};
+  for (auto value : values) {
+    std::size_t length = 0;
+    k(value) >> [&](upd::byte_t byte) { kbuf[length++] = byte; };
+
+    for (std::size_t i = 0; i < length - 1; i++)
+      TEST_ASSERT_EQUAL(packet_status::LOADING_PACKET, dis.put(kbuf[i]));
+    TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis.put(kbuf[length - 1]));
+
+    dis >> kbuf;
+    TEST_ASSERT_EQUAL(value, k << kbuf);
+  }
+}
+
+static void buffered_dispatcher_DO_read_consecutive_varint_requests_EXPECT_each_request_resolved() {
+  using namespace upd;
+
+  upd::byte_t kbuf[32];
+  auto dis = make_double_buffered_dispatcher(varint_kring, policy::weak_reference);
+  auto k_identity = varint_kring.get(UPD_CTREF(identity));
+  auto k_check = varint_kring.get(UPD_CTREF(check_64));
+
+  std::size_t length = 0;
+  auto output = [&](upd::byte_t byte) { kbuf[length++] = byte; };
+  k_check(64) >> output;
+  k_identity(-300) >> output;
+  TEST_ASSERT_EQUAL(1 + 2 + 1 + 2, length);
+
+  auto *ptr = kbuf;
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis.read_from([&]() { return *ptr++; }));
+  TEST_ASSERT_EQUAL(3, ptr - kbuf);
+  TEST_ASSERT_EQUAL(0, k_check.read_from([&]() { return dis.get(); }));
+
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis.read_from([&]() { return *ptr++; }));
+  TEST_ASSERT_EQUAL(6, ptr - kbuf);
+  TEST_ASSERT_EQUAL(-300, k_identity.read_from([&]() { return dis.get(); }));
+}
+
+static void buffered_dispatcher_DO_put_chunk_with_output_EXPECT_every_packet_resolved() {
+  using namespace upd;
+
+  std::vector<upd::byte_t> chunk, responses;
+  auto input = std::back_inserter(chunk);
+  auto k_identity = kring.get(UPD_CTREF(identity));
+  k_identity(1) >> input;
+  k_identity(-2) >> input;
+  chunk.push_back(0xff);
+  k_identity(3) >> input;
+  k_identity(4) >> input;
+
+  auto dis = make_double_buffered_dispatcher(kring, policy::weak_reference);
+  auto result = dis.put(chunk.data(), chunk.size() - 3, std::back_inserter(responses));
+
+  TEST_ASSERT_EQUAL(chunk.size() - 3, result.consumed);
+  TEST_ASSERT_EQUAL(3 * sizeof(std::int64_t), result.written);
+  TEST_ASSERT_EQUAL(3, result.resolved_count);
+  TEST_ASSERT_EQUAL(1, result.dropped_count);
+  TEST_ASSERT_EQUAL(packet_status::LOADING_PACKET, result.status);
+  TEST_ASSERT_EQUAL(3 * sizeof(std::int64_t), responses.size());
+
+  std::vector<upd::byte_t> rest(chunk.end() - 3, chunk.end());
+  result = dis.put(rest, std::back_inserter(responses));
+
+  TEST_ASSERT_EQUAL(3, result.consumed);
+  TEST_ASSERT_EQUAL(1, result.resolved_count);
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, result.status);
+
+  auto *ptr = responses.data();
+  auto fetch_byte = [&]() { return *ptr++; };
+  TEST_ASSERT_EQUAL(1, k_identity.read_from(fetch_byte));
+  TEST_ASSERT_EQUAL(-2, k_identity.read_from(fetch_byte));
+  TEST_ASSERT_EQUAL(3, k_identity.read_from(fetch_byte));
+  TEST_ASSERT_EQUAL(4, k_identity.read_from(fetch_byte));
+}
+
+static void buffered_dispatcher_DO_put_chunk_without_output_EXPECT_stop_after_first_resolved_packet() {
+  using namespace upd;
+
+  upd::byte_t chunk[64];
+  std::size_t length = 0;
+  auto input = [&](upd::byte_t byte) { chunk[length++] = byte; };
+  auto k_identity = varint_kring.get(UPD_CTREF(identity));
+  auto k_void = varint_kring.get(UPD_CTREF(void_procedure));
+  k_identity(-300) >> input;
+  k_void() >> input;
+  k_identity(1 << 20) >> input;
+
+  auto dis = make_single_buffered_dispatcher(varint_kring, policy::weak_reference);
+  std::size_t offset = 0;
+
+  auto result = dis.put(chunk, length);
+  TEST_ASSERT_EQUAL(1 + 2, result.consumed);
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, result.status);
+  TEST_ASSERT_EQUAL(-300, k_identity.read_from([&]() { return dis.get(); }));
+  offset += result.consumed;
+
+  result = dis.put(chunk + offset, length - offset);
+  TEST_ASSERT_EQUAL(1, result.consumed);
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, result.status);
+  TEST_ASSERT_FALSE(dis.is_loaded());
+  offset += result.consumed;
+
+  result = dis.put(chunk + offset, length - offset);
+  TEST_ASSERT_EQUAL(length - offset, result.consumed);
+  TEST_ASSERT_EQUAL(1, result.resolved_count);
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, result.status);
+  TEST_ASSERT_EQUAL(1 << 20, k_identity.read_from([&]() { return dis.get(); }));
+}
+
 int main() {
   using namespace upd;
 
@@ -299,5 +427,9 @@ int main() {
   RUN_TEST(buffered_dispatcher_DO_create_double_buffered_dispatcher_with_no_storage_action);
   RUN_TEST(buffered_dispatcher_DO_reply);
   RUN_TEST(buffered_dispatcher_DO_use_parenthesis_operator);
+  RUN_TEST(buffered_dispatcher_DO_insert_varint_requests_one_by_one_EXPECT_resolved_on_last_byte);
+  RUN_TEST(buffered_dispatcher_DO_read_consecutive_varint_requests_EXPECT_each_request_resolved);
+  RUN_TEST(buffered_dispatcher_DO_put_chunk_with_output_EXPECT_every_packet_resolved);
+  RUN_TEST(buffered_dispatcher_DO_put_chunk_without_output_EXPECT_stop_after_first_resolved_packet);
   return UNITY_END();
 }
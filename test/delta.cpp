@@ -0,0 +1,225 @@
+#include <memory>
+#include <type_traits>
+
+#include <upd/action.hpp>
+#include <upd/buffered_dispatcher.hpp>
+#include <upd/delta.hpp>
+#include <upd/dispatcher.hpp>
+#include <upd/key.hpp>
+#include <upd/keyring.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+int32_t report(int16_t x, int16_t y, uint8_t status, int32_t counter) { return x + y + status + counter; }
+void ping() {}
+int64_t store(int64_t x, int64_t y) { return x ^ y; }
+
+constexpr auto kring =
+    upd::make_keyring(upd::make_flist(UPD_CTREF(ping), UPD_CTREF(report)), upd::little_endian, upd::twos_complement);
+
+// `store` makes the input buffer of the buffered dispatchers large enough to hold the keyframes of `report`
+constexpr auto buffered_kring = upd::make_keyring(
+    upd::make_flist(UPD_CTREF(ping), UPD_CTREF(report), UPD_CTREF(store)), upd::little_endian, upd::twos_complement);
+
+static void delta_DO_send_nearly_identical_arguments_EXPECT_only_changed_fields() {
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(report));
+  auto encoder = make_delta_encoder(k, 0);
+  static_assert(decltype(encoder)::header_size == 1, "");
+  static_assert(decltype(encoder)::payload_length == k.payload_length + 1, "");
+
+  byte_t buf[decltype(encoder)::payload_length];
+  std::size_t i = 0;
+  auto dest = [&](byte_t byte) { buf[i++] = byte; };
+
+  encoder(1, 2, 3, 4) >> dest;
+  TEST_ASSERT_EQUAL_UINT(decltype(encoder)::payload_length, i);
+  TEST_ASSERT_EQUAL_UINT8(0x0f, buf[1]);
+
+  i = 0;
+  encoder(1, 2, 3, 5) >> dest;
+  TEST_ASSERT_EQUAL_UINT(1 + 1 + 4, i);
+  TEST_ASSERT_EQUAL_UINT8(0x08, buf[1]);
+  TEST_ASSERT_EQUAL_UINT8(5, buf[2]);
+
+  i = 0;
+  encoder(1, 2, 3, 5) >> dest;
+  TEST_ASSERT_EQUAL_UINT(1 + 1, i);
+  TEST_ASSERT_EQUAL_UINT8(0x00, buf[1]);
+
+  i = 0;
+  encoder(-1, 2, 7, 5) >> dest;
+  TEST_ASSERT_EQUAL_UINT(1 + 1 + 2 + 1, i);
+  TEST_ASSERT_EQUAL_UINT8(0x05, buf[1]);
+}
+
+static void delta_DO_reach_keyframe_period_EXPECT_every_field_sent() {
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(report));
+  auto encoder = make_delta_encoder(k, 3);
+
+  std::size_t lengths[7], i;
+  for (auto &length : lengths) {
+    i = 0;
+    encoder(1, 2, 3, 4) >> [&](byte_t) { i++; };
+    length = i;
+  }
+
+  TEST_ASSERT_EQUAL_UINT(k.payload_length + 1, lengths[0]);
+  TEST_ASSERT_EQUAL_UINT(2, lengths[1]);
+  TEST_ASSERT_EQUAL_UINT(2, lengths[2]);
+  TEST_ASSERT_EQUAL_UINT(k.payload_length + 1, lengths[3]);
+  TEST_ASSERT_EQUAL_UINT(2, lengths[4]);
+
+  encoder.request_keyframe();
+  i = 0;
+  encoder(1, 2, 3, 4) >> [&](byte_t) { i++; };
+  TEST_ASSERT_EQUAL_UINT(k.payload_length + 1, i);
+}
+
+static void delta_DO_dispatch_delta_packets_EXPECT_missing_fields_from_previous_call() {
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(report));
+  auto encoder = make_delta_encoder(k, 100);
+  auto dispatcher = make_dispatcher(kring, policy::any_callback);
+  dispatcher[k.index] = make_delta_action(report, little_endian, twos_complement);
+
+  const int16_t xs[] = {10, 10, 12, 12, -3};
+  const uint8_t statuses[] = {1, 2, 2, 2, 2};
+  for (std::size_t n = 0; n < 5; n++) {
+    byte_t buf[decltype(encoder)::payload_length];
+    std::size_t i = 0, j = 0, l = 0;
+    encoder(xs[n], 20, statuses[n], 1000) >> [&](byte_t byte) { buf[i++] = byte; };
+
+    auto output = make_tuple<int32_t>(little_endian, twos_complement);
+    dispatcher([&]() { return buf[j++]; }, [&](byte_t byte) { output[l++] = byte; });
+    TEST_ASSERT_EQUAL_INT32(report(xs[n], 20, statuses[n], 1000), output.get<0>());
+  }
+}
+
+static void delta_DO_call_delta_action_in_place_EXPECT_same_result_as_byte_getter() {
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(report));
+  auto encoder = make_delta_encoder(k, 0);
+  auto a = make_delta_action(report, little_endian, twos_complement, fixed_width);
+  TEST_ASSERT_EQUAL_UINT(decltype(encoder)::payload_length - sizeof(k.index), a.input_size());
+  TEST_ASSERT_EQUAL_UINT(4, a.output_size());
+
+  byte_t buf[decltype(encoder)::payload_length];
+  int32_t result = 0;
+  auto read_result = [&](byte_t byte) { result = result >> 8 | int32_t(uint32_t(byte) << 24); };
+
+  std::size_t i = 0;
+  encoder(5, 6, 7, 8) >> [&](byte_t byte) { buf[i++] = byte; };
+  a.call_in_place(buf + sizeof(k.index), read_result);
+  TEST_ASSERT_EQUAL_INT32(26, result);
+
+  i = 0;
+  encoder(5, -6, 7, 8) >> [&](byte_t byte) { buf[i++] = byte; };
+  a.call_in_place(buf + sizeof(k.index), read_result);
+  TEST_ASSERT_EQUAL_INT32(14, result);
+}
+
+static void delta_DO_put_delta_packets_in_double_buffered_dispatcher_EXPECT_requests_framed_from_header() {
+  using namespace upd;
+
+  constexpr auto k = buffered_kring.get(UPD_CTREF(report));
+  constexpr auto k_store = buffered_kring.get(UPD_CTREF(store));
+  auto encoder = make_delta_encoder(k, 100);
+  auto dis = make_double_buffered_dispatcher(buffered_kring, policy::any_callback);
+  dis[k.index] = make_delta_action(report, little_endian, twos_complement);
+
+  const int16_t xs[] = {10, 10, 12, 12, -3};
+  const uint8_t statuses[] = {1, 2, 2, 2, 2};
+  for (std::size_t n = 0; n < 5; n++) {
+    byte_t buf[decltype(encoder)::payload_length];
+    std::size_t i = 0;
+    encoder(xs[n], 20, statuses[n], 1000) >> [&](byte_t byte) { buf[i++] = byte; };
+
+    for (std::size_t j = 0; j + 1 < i; j++)
+      TEST_ASSERT_EQUAL(packet_status::LOADING_PACKET, dis.put(buf[j]));
+    TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis.put(buf[i - 1]));
+
+    auto output = make_tuple<int32_t>(little_endian, twos_complement);
+    dis.write_to(output.begin());
+    TEST_ASSERT_EQUAL_INT32(report(xs[n], 20, statuses[n], 1000), output.get<0>());
+  }
+
+  byte_t chunk[2 * decltype(encoder)::payload_length + decltype(k_store)::payload_length];
+  byte_t *ptr = chunk;
+  encoder(-3, 21, 2, 1000) >> [&](byte_t byte) { *ptr++ = byte; };
+  encoder(-3, 21, 2, 1000) >> [&](byte_t byte) { *ptr++ = byte; };
+  k_store(6, 3) >> [&](byte_t byte) { *ptr++ = byte; };
+
+  auto output = make_tuple<int32_t, int32_t, int64_t>(little_endian, twos_complement);
+  auto result = dis.put(chunk, std::size_t(ptr - chunk), output.begin());
+  TEST_ASSERT_EQUAL_UINT(ptr - chunk, result.consumed);
+  TEST_ASSERT_EQUAL_UINT(3, result.resolved_count);
+  TEST_ASSERT_EQUAL_UINT(0, result.dropped_count);
+  TEST_ASSERT_EQUAL_UINT(4 + 4 + 8, result.written);
+  TEST_ASSERT_EQUAL_INT32(report(-3, 21, 2, 1000), output.get<0>());
+  TEST_ASSERT_EQUAL_INT32(report(-3, 21, 2, 1000), output.get<1>());
+  TEST_ASSERT_EQUAL_INT64(store(6, 3), output.get<2>());
+}
+
+static void delta_DO_put_keyframe_larger_than_input_buffer_EXPECT_packet_dropped() {
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(report));
+  auto encoder = make_delta_encoder(k, 100);
+  auto dis = make_double_buffered_dispatcher(kring, policy::any_callback);
+  dis[k.index] = make_delta_action(report, little_endian, twos_complement);
+  static_assert(decltype(dis)::input_buffer_size < decltype(encoder)::payload_length, "");
+
+  byte_t buf[decltype(encoder)::payload_length];
+  std::size_t i = 0;
+  encoder(1, 2, 3, 4) >> [&](byte_t byte) { buf[i++] = byte; };
+  TEST_ASSERT_EQUAL(packet_status::LOADING_PACKET, dis.put(buf[0]));
+  TEST_ASSERT_EQUAL(packet_status::DROPPED_PACKET, dis.put(buf[1]));
+}
+
+static void delta_DO_process_batch_of_delta_packets_EXPECT_requests_framed_from_header() {
+  using namespace upd;
+
+  static_assert(!std::is_constructible<action, std::unique_ptr<detail::action_concept>>::value, "");
+
+  constexpr auto k = kring.get(UPD_CTREF(report));
+  constexpr auto k_ping = kring.get(UPD_CTREF(ping));
+  auto encoder = make_delta_encoder(k, 100);
+  auto dispatcher = make_dispatcher(kring, policy::any_callback);
+  dispatcher[k.index] = make_delta_action(report, little_endian, twos_complement);
+
+  byte_t input[3 * decltype(encoder)::payload_length + decltype(k_ping)::payload_length];
+  byte_t *ptr = input;
+  auto dest = [&](byte_t byte) { *ptr++ = byte; };
+  encoder(1, 2, 3, 4) >> dest;
+  encoder(1, 5, 3, 4) >> dest;
+  k_ping() >> dest;
+  encoder(1, 5, 3, 4) >> dest;
+
+  auto output = make_tuple<int32_t, int32_t, int32_t>(little_endian, twos_complement);
+  auto result = dispatcher.process_batch(input, std::size_t(ptr - input), output.begin(), output.size);
+  TEST_ASSERT_EQUAL_UINT(4, result.packet_count);
+  TEST_ASSERT_EQUAL_UINT(ptr - input, result.consumed);
+  TEST_ASSERT_EQUAL_UINT(output.size, result.produced);
+  TEST_ASSERT_EQUAL_INT32(report(1, 2, 3, 4), output.get<0>());
+  TEST_ASSERT_EQUAL_INT32(report(1, 5, 3, 4), output.get<1>());
+  TEST_ASSERT_EQUAL_INT32(report(1, 5, 3, 4), output.get<2>());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(delta_DO_send_nearly_identical_arguments_EXPECT_only_changed_fields);
+  RUN_TEST(delta_DO_reach_keyframe_period_EXPECT_every_field_sent);
+  RUN_TEST(delta_DO_dispatch_delta_packets_EXPECT_missing_fields_from_previous_call);
+  RUN_TEST(delta_DO_call_delta_action_in_place_EXPECT_same_result_as_byte_getter);
+  RUN_TEST(delta_DO_put_delta_packets_in_double_buffered_dispatcher_EXPECT_requests_framed_from_header);
+  RUN_TEST(delta_DO_put_keyframe_larger_than_input_buffer_EXPECT_packet_dropped);
+  RUN_TEST(delta_DO_process_batch_of_delta_packets_EXPECT_requests_framed_from_header);
+  return UNITY_END();
+}
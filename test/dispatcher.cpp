@@ -1,3 +1,8 @@
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include <upd/dispatcher.hpp>
 #include <upd/format.hpp>
 #include <upd/keyring.hpp>
@@ -9,6 +14,8 @@ int get_8() { return 8; }
 int get_16() { return 16; }
 int get_32() { return 32; }
 int identity(int x) { return x; }
+std::tuple<int, char> split(int x) { return std::make_tuple(x / 2, char(x % 2)); }
+std::pair<short, bool> compare(int x, int y) { return std::make_pair(short(x - y), x < y); }
 
 constexpr auto ftor_list = upd::make_flist(UPD_CTREF(get_8), UPD_CTREF(get_16), UPD_CTREF(get_32), UPD_CTREF(identity));
 
@@ -59,6 +66,38 @@ static void dispatcher_DO_call_no_storage_action_EXPECT_correct_behavior() {
   TEST_ASSERT_EQUAL_UINT(16, output.get<0>());
 }
 
+static void dispatcher_DO_call_no_storage_action_returning_tuple_EXPECT_every_element_written() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(make_flist(UPD_CTREF(split), UPD_CTREF(compare)), little_endian, twos_complement);
+  auto dispatcher = make_dispatcher(kring, policy::weak_reference);
+  constexpr auto k_split = kring.get(UPD_CTREF(split));
+  constexpr auto k_compare = kring.get(UPD_CTREF(compare));
+
+  std::vector<byte_t> input, output;
+  k_split(-7).write_to(std::back_inserter(input));
+  k_compare(3, 10).write_to(std::back_inserter(input));
+
+  auto it = input.cbegin();
+  auto input_f = [&]() { return *it++; };
+  auto output_f = [&](byte_t byte) { output.push_back(byte); };
+  dispatcher(input_f, output_f);
+  dispatcher(input_f, output_f);
+
+  auto expected = upd::make_tuple(little_endian, twos_complement, int{-3}, char{-1}, short{-7}, bool{true});
+  TEST_ASSERT_EQUAL_UINT(expected.size, output.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.begin(), output.data(), output.size());
+
+  auto *ptr = output.data();
+  auto fetch_byte = [&]() { return *ptr++; };
+  auto split_result = k_split.read_from(fetch_byte);
+  TEST_ASSERT_EQUAL_INT(-3, std::get<0>(split_result));
+  TEST_ASSERT_EQUAL_INT(-1, std::get<1>(split_result));
+  auto compare_result = k_compare.read_from(fetch_byte);
+  TEST_ASSERT_EQUAL_INT(-7, compare_result.first);
+  TEST_ASSERT_TRUE(compare_result.second);
+}
+
 static void dispatcher_DO_replace_an_action_EXPECT_changed_action() {
   using namespace upd;
 
@@ -99,6 +138,68 @@ static void dispatcher_DO_replace_a_no_storage_action_EXPECT_changed_action() {
   TEST_ASSERT_EQUAL_UINT(32, output.get<0>());
 }
 
+static void dispatcher_DO_process_batch_EXPECT_responses_back_to_back() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, little_endian, twos_complement);
+  auto dispatcher = make_dispatcher(kring, policy::weak_reference);
+  using index_t = decltype(dispatcher)::index_t;
+  auto k_get_8 = kring.get(UPD_CTREF(get_8));
+  auto k_identity = kring.get(UPD_CTREF(identity));
+
+  std::vector<upd::byte_t> input, output(4 * sizeof(int) + 2);
+  auto it = std::back_inserter(input);
+  k_get_8() >> it;
+  k_identity(5) >> it;
+  k_identity(-7) >> it;
+  k_get_8() >> it;
+  k_identity(9) >> it;
+  input.pop_back();
+
+  auto result = dispatcher.process_batch(input, output);
+  TEST_ASSERT_EQUAL(4, result.packet_count);
+  TEST_ASSERT_EQUAL(input.size() - sizeof(index_t) - sizeof(int) + 1, result.consumed);
+  TEST_ASSERT_EQUAL(4 * sizeof(int), result.produced);
+
+  auto *ptr = output.data();
+  auto fetch_byte = [&]() { return *ptr++; };
+  TEST_ASSERT_EQUAL(8, k_get_8.read_from(fetch_byte));
+  TEST_ASSERT_EQUAL(5, k_identity.read_from(fetch_byte));
+  TEST_ASSERT_EQUAL(-7, k_identity.read_from(fetch_byte));
+  TEST_ASSERT_EQUAL(8, k_get_8.read_from(fetch_byte));
+
+  result = dispatcher.process_batch(input.data(), input.size(), output.data(), sizeof(int) + 2);
+  TEST_ASSERT_EQUAL(1, result.packet_count);
+  TEST_ASSERT_EQUAL(sizeof(index_t), result.consumed);
+  TEST_ASSERT_EQUAL(sizeof(int), result.produced);
+}
+
+static void dispatcher_DO_process_batch_of_varint_requests_EXPECT_stop_at_invalid_index() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, little_endian, twos_complement, varint);
+  auto dispatcher = make_dispatcher(kring, policy::any_callback);
+  auto k_identity = kring.get(UPD_CTREF(identity));
+
+  std::vector<upd::byte_t> input, output(64);
+  auto it = std::back_inserter(input);
+  k_identity(1) >> it;
+  k_identity(-100000) >> it;
+  auto length = input.size();
+  input.push_back(0xff), input.push_back(0xff);
+  k_identity(3) >> it;
+
+  auto result = dispatcher.process_batch(input, output);
+  TEST_ASSERT_EQUAL(2, result.packet_count);
+  TEST_ASSERT_EQUAL(length, result.consumed);
+  TEST_ASSERT_EQUAL(1 + 3, result.produced);
+
+  auto *ptr = output.data();
+  auto fetch_byte = [&]() { return *ptr++; };
+  TEST_ASSERT_EQUAL(1, k_identity.read_from(fetch_byte));
+  TEST_ASSERT_EQUAL(-100000, k_identity.read_from(fetch_byte));
+}
+
 int main() {
   using namespace upd;
 
@@ -106,7 +207,10 @@ int main() {
   RUN_TEST(dispatcher_DO_call_action_EXPECT_calling_correct_action);
   RUN_TEST(dispatcher_DO_get_action_EXPECT_correct_index);
   RUN_TEST(dispatcher_DO_call_no_storage_action_EXPECT_correct_behavior);
+  RUN_TEST(dispatcher_DO_call_no_storage_action_returning_tuple_EXPECT_every_element_written);
   RUN_TEST(dispatcher_DO_replace_an_action_EXPECT_changed_action);
   RUN_TEST(dispatcher_DO_replace_a_no_storage_action_EXPECT_changed_action);
+  RUN_TEST(dispatcher_DO_process_batch_EXPECT_responses_back_to_back);
+  RUN_TEST(dispatcher_DO_process_batch_of_varint_requests_EXPECT_stop_at_invalid_index);
   return UNITY_END();
 }
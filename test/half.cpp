@@ -0,0 +1,137 @@
+#include <limits>
+
+#include <upd/action.hpp>
+#include <upd/half.hpp>
+#include <upd/key.hpp>
+#include <upd/keyring.hpp>
+#include <upd/tuple.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+upd::float16 scale(upd::float16 x, upd::bfloat16 factor) { return x * factor; }
+
+constexpr auto kring = upd::make_keyring(upd::make_flist(UPD_CTREF(scale)), upd::big_endian, upd::twos_complement);
+
+static void half_DO_convert_float_EXPECT_nearest_even_binary16() {
+  using upd::float16;
+
+  TEST_ASSERT_EQUAL_HEX16(0x3c00, float16{1.f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0xc000, float16{-2.f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x8000, float16{-0.f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x7bff, float16{65504.f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x7bff, float16{65519.f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x7c00, float16{65520.f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x0400, float16{6.103515625e-5f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x0001, float16{5.9604645e-8f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x0000, float16{2.9802322e-8f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x0001, float16{4.5e-8f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x3c00, float16{1.00048828125f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x3c02, float16{1.00146484375f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x7e00, float16{std::numeric_limits<float>::quiet_NaN()}.raw() & 0x7e00);
+
+  TEST_ASSERT_EQUAL_FLOAT(1.f, float16::from_raw(0x3c00));
+  TEST_ASSERT_EQUAL_FLOAT(65504.f, float16::from_raw(0x7bff));
+  TEST_ASSERT_EQUAL_FLOAT(5.9604645e-8f, float16::from_raw(0x0001));
+  TEST_ASSERT_EQUAL_FLOAT(-0.333251953125f, float16::from_raw(0xb555));
+}
+
+static void half_DO_convert_float_EXPECT_nearest_even_bfloat16() {
+  using upd::bfloat16;
+
+  TEST_ASSERT_EQUAL_HEX16(0x3f80, bfloat16{1.f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0xc040, bfloat16{-3.f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x3f80, bfloat16{1.00390625f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x3f82, bfloat16{1.01171875f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x7f80, bfloat16{3.4e38f}.raw());
+  TEST_ASSERT_EQUAL_HEX16(0x7fc0, bfloat16{std::numeric_limits<float>::quiet_NaN()}.raw() & 0x7fc0);
+
+  TEST_ASSERT_EQUAL_FLOAT(-3.f, bfloat16::from_raw(0xc040));
+  TEST_ASSERT_EQUAL_FLOAT(1.0078125f, bfloat16::from_raw(0x3f81));
+}
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void half_DO_serialize_in_tuple_EXPECT_16_bit_representation() {
+  using namespace upd;
+
+  const float16 values[] = {1.f, -2.f, 0.5f};
+  const uint16_t raws[] = {0x3c00, 0xc000, 0x3800};
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, bfloat16{1.f}, values);
+  auto expected = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, uint16_t{0x3f80}, raws);
+
+  TEST_ASSERT_EQUAL_INT(2 + 3 * 2, t.size);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.begin(), t.begin(), t.size);
+
+  auto read_values = t.template get<1>();
+  for (std::size_t i = 0; i < 3; i++)
+    TEST_ASSERT_EQUAL_HEX16(raws[i], read_values[i].raw());
+  TEST_ASSERT_EQUAL_FLOAT(1.f, t.template get<0>());
+}
+
+MAKE_MULTIOPT(half_DO_serialize_in_tuple_EXPECT_16_bit_representation)
+
+static void half_DO_call_action_through_key_EXPECT_float_interface() {
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(scale));
+  static_assert(k.payload_length == 1 + 2 + 2, "");
+
+  action a{scale, big_endian, twos_complement};
+  byte_t buf[k.payload_length];
+
+  int i = 0, j = 0, l = 0;
+  k(1.5f, -4.f) >> [&](byte_t byte) { buf[i++] = byte; };
+  j = sizeof k.index;
+  a([&]() { return buf[j++]; }, [&](byte_t byte) { buf[l++] = byte; });
+  l = 0;
+  float result = k << [&]() { return buf[l++]; };
+
+  TEST_ASSERT_EQUAL_FLOAT(-6.f, result);
+}
+
+static void half_DO_convert_arrays_EXPECT_same_values_as_one_by_one() {
+  float values[67], widened[67];
+  upd::float16 halves[67];
+  upd::bfloat16 bhalves[67];
+  for (std::size_t i = 0; i < 67; i++)
+    values[i] = (float(i) - 33.f) * 1234.5678f;
+  values[3] = std::numeric_limits<float>::infinity();
+  values[4] = 1e-6f;
+
+  upd::quantize_n(values, halves, 67);
+  upd::quantize_n(values, bhalves, 67);
+  for (std::size_t i = 0; i < 67; i++) {
+    TEST_ASSERT_EQUAL_HEX16(upd::float16{values[i]}.raw(), halves[i].raw());
+    TEST_ASSERT_EQUAL_HEX16(upd::bfloat16{values[i]}.raw(), bhalves[i].raw());
+  }
+
+  upd::dequantize_n(bhalves, widened, 67);
+  for (std::size_t i = 0; i < 67; i++)
+    TEST_ASSERT_EQUAL_FLOAT(bhalves[i].value(), widened[i]);
+
+  // Every binary16 value is converted back and forth
+  upd::float16 every_halves[256];
+  float every_values[256];
+  for (uint32_t high = 0; high < 256; high++) {
+    for (uint32_t low = 0; low < 256; low++)
+      every_halves[low] = upd::float16::from_raw(uint16_t(high << 8 | low));
+
+    upd::dequantize_n(every_halves, every_values, 256);
+    for (std::size_t low = 0; low < 256; low++) {
+      auto expected = every_halves[low].value();
+      TEST_ASSERT_EQUAL_MEMORY(&expected, &every_values[low], sizeof(float));
+      if (every_values[low] == every_values[low])
+        TEST_ASSERT_EQUAL_HEX16(every_halves[low].raw(), upd::float16{every_values[low]}.raw());
+    }
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(half_DO_convert_float_EXPECT_nearest_even_binary16);
+  RUN_TEST(half_DO_convert_float_EXPECT_nearest_even_bfloat16);
+  half_DO_serialize_in_tuple_EXPECT_16_bit_representation_multiopt(every_options);
+  RUN_TEST(half_DO_call_action_through_key_EXPECT_float_interface);
+  RUN_TEST(half_DO_convert_arrays_EXPECT_same_values_as_one_by_one);
+  return UNITY_END();
+}
@@ -0,0 +1,113 @@
+#include <upd/action.hpp>
+#include <upd/int_n.hpp>
+#include <upd/key.hpp>
+#include <upd/keyring.hpp>
+#include <upd/tuple.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+using sample_t = upd::int_n<24>;
+
+int32_t sum(const std::array<sample_t, 5> &samples, upd::uint_n<40> offset) {
+  int32_t retval = 0;
+  for (auto sample : samples)
+    retval += sample;
+  return retval + int32_t(offset);
+}
+
+constexpr auto kring = upd::make_keyring(upd::make_flist(UPD_CTREF(sum)), upd::big_endian, upd::ones_complement);
+
+static void int_n_DO_construct_from_value_EXPECT_truncated_to_width() {
+  static_assert(sizeof(sample_t) == 4 && sample_t::size == 3, "");
+  static_assert(sizeof(upd::uint_n<40>) == 8 && upd::uint_n<40>::size == 5, "");
+  static_assert(std::is_same<upd::uint_n<12>::value_t, uint16_t>::value, "");
+  static_assert(upd::detail::serialization_size<upd::uint_n<12>>::value == 2, "");
+
+  TEST_ASSERT_EQUAL_HEX32(0x345678, upd::uint_n<24>{0x12345678}.value());
+  TEST_ASSERT_EQUAL_INT32(-5, sample_t{-5});
+  TEST_ASSERT_EQUAL_INT32(-8388608, sample_t{0x800000});
+  TEST_ASSERT_EQUAL_INT32(8388607, sample_t{0x7fffff});
+  TEST_ASSERT_EQUAL_INT16(-2048, upd::int_n<12>{2048});
+  TEST_ASSERT_EQUAL_INT16(1, upd::int_n<12>{4097});
+}
+
+static void int_n_DO_serialize_negative_value_EXPECT_every_signed_mode_in_width() {
+  using namespace upd;
+
+  byte_t buf[3];
+  detail::write_as<endianess::BIG, signed_mode::TWOS_COMPLEMENT>(sample_t{-2}, buf);
+  TEST_ASSERT_EQUAL_HEX32(0xfffffe, buf[0] << 16 | buf[1] << 8 | buf[2]);
+  detail::write_as<endianess::BIG, signed_mode::ONES_COMPLEMENT>(sample_t{-2}, buf);
+  TEST_ASSERT_EQUAL_HEX32(0xfffffd, buf[0] << 16 | buf[1] << 8 | buf[2]);
+  detail::write_as<endianess::BIG, signed_mode::SIGNED_MAGNITUDE>(sample_t{-2}, buf);
+  TEST_ASSERT_EQUAL_HEX32(0x800002, buf[0] << 16 | buf[1] << 8 | buf[2]);
+  detail::write_as<endianess::BIG, signed_mode::OFFSET_BINARY>(sample_t{-2}, buf);
+  TEST_ASSERT_EQUAL_HEX32(0x7ffffe, buf[0] << 16 | buf[1] << 8 | buf[2]);
+
+  byte_t narrow[] = {0x08, 0x01};
+  TEST_ASSERT_EQUAL_INT16(-2047, (detail::read_as<int_n<12>, endianess::BIG, signed_mode::TWOS_COMPLEMENT>(narrow)));
+  TEST_ASSERT_EQUAL_INT16(-1, (detail::read_as<int_n<12>, endianess::BIG, signed_mode::SIGNED_MAGNITUDE>(narrow)));
+  TEST_ASSERT_EQUAL_INT16(-2046, (detail::read_as<int_n<12>, endianess::BIG, signed_mode::ONES_COMPLEMENT>(narrow)));
+  TEST_ASSERT_EQUAL_INT16(1, (detail::read_as<int_n<12>, endianess::BIG, signed_mode::OFFSET_BINARY>(narrow)));
+}
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void int_n_DO_serialize_arrays_EXPECT_same_bytes_as_one_by_one() {
+  using namespace upd;
+
+  sample_t samples[150];
+  uint_n<40> counters[150];
+  for (int i = 0; i < 150; i++) {
+    samples[i] = (i - 75) * 111000;
+    counters[i] = uint64_t(i) * 0x1234567891ull;
+  }
+
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, samples, counters);
+  TEST_ASSERT_EQUAL_INT(150 * 3 + 150 * 5, t.size);
+
+  byte_t expected[150 * 3 + 150 * 5];
+  for (std::size_t i = 0; i < 150; i++) {
+    detail::write_as<Endianess, Signed_Mode>(samples[i], expected + i * 3);
+    detail::write_as<Endianess, Signed_Mode>(counters[i], expected + 150 * 3 + i * 5);
+  }
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, t.begin(), t.size);
+
+  auto read_samples = t.template get<0>();
+  auto read_counters = t.template get<1>();
+  for (std::size_t i = 0; i < 150; i++) {
+    TEST_ASSERT_EQUAL_INT32(samples[i], read_samples[i]);
+    TEST_ASSERT_TRUE(counters[i] == read_counters[i]);
+  }
+}
+
+MAKE_MULTIOPT(int_n_DO_serialize_arrays_EXPECT_same_bytes_as_one_by_one)
+
+static void int_n_DO_call_action_through_key_EXPECT_integer_interface() {
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(sum));
+  static_assert(k.payload_length == 1 + 5 * 3 + 5, "");
+
+  action a{sum, big_endian, ones_complement};
+  byte_t buf[k.payload_length];
+
+  int i = 0, j = 0, l = 0;
+  std::array<sample_t, 5> samples{{-8000000, 7000000, -3, 4, 5}};
+  k(samples, 0xff00000010ull) >> [&](byte_t byte) { buf[i++] = byte; };
+  j = sizeof k.index;
+  a([&]() { return buf[j++]; }, [&](byte_t byte) { buf[l++] = byte; });
+  l = 0;
+  int32_t result = k << [&]() { return buf[l++]; };
+
+  TEST_ASSERT_EQUAL_INT32(-1000000 + 6 + 16, result);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(int_n_DO_construct_from_value_EXPECT_truncated_to_width);
+  RUN_TEST(int_n_DO_serialize_negative_value_EXPECT_every_signed_mode_in_width);
+  int_n_DO_serialize_arrays_EXPECT_same_bytes_as_one_by_one_multiopt(every_options);
+  RUN_TEST(int_n_DO_call_action_through_key_EXPECT_integer_interface);
+  return UNITY_END();
+}
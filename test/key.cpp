@@ -1,3 +1,6 @@
+#include <tuple>
+#include <utility>
+
 #include <upd/key.hpp>
 #include <upd/keyring.hpp>
 #include <upd/typelist.hpp>
@@ -16,13 +19,17 @@ int integer_function(int, short, char);
 int procedure();
 auto functor = [](int x) { return x; };
 const object_t &function_object(const object_t &x) { return x; }
+std::tuple<int16_t, uint32_t, bool> state_function();
+std::pair<uint8_t, int32_t> pair_function();
 
 constexpr auto list = upd::make_flist(UPD_CTREF(function),
                                       UPD_CTREF(big_function),
                                       UPD_CTREF(integer_function),
                                       UPD_CTREF(procedure),
                                       UPD_CTREF(functor),
-                                      UPD_CTREF(function_object));
+                                      UPD_CTREF(function_object),
+                                      UPD_CTREF(state_function),
+                                      UPD_CTREF(pair_function));
 constexpr auto kring = upd::make_keyring(list, upd::little_endian, upd::twos_complement);
 
 template<>
@@ -129,6 +136,72 @@ static void key_base_DO_hook_a_callback_EXPECT_callback_receiving_correct_argume
   k.with_hook([](int value) { TEST_ASSERT_EQUAL_INT(64, value); })([&]() { return t[i++]; });
 }
 
+static void key_base_DO_serialize_arguments_with_varint_encoding_EXPECT_leb128_zigzag_byte_sequence() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(list, upd::little_endian, upd::twos_complement, upd::varint);
+  constexpr auto k = kring.get(UPD_CTREF(integer_function));
+  const upd::byte_t expected[] = {2, 0xd8, 0x04, 0x03, 0x05};
+  upd::byte_t dest_buf[sizeof expected + 1] = {};
+
+  static_assert(k.payload_length == 1 + 5 + 3 + 1, "");
+
+  int i = 0;
+  k(300, -2, 5) >> [&](upd::byte_t byte) { dest_buf[i++] = byte; };
+
+  TEST_ASSERT_EQUAL_INT(sizeof expected, i);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, dest_buf, sizeof expected);
+}
+
+static void key_base_DO_unserialize_data_sequence_with_varint_encoding_EXPECT_correct_value() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(list, upd::little_endian, upd::twos_complement, upd::varint);
+  constexpr auto k = kring.get(UPD_CTREF(integer_function));
+  const upd::byte_t small_src[] = {0x7f};
+  const upd::byte_t large_src[] = {0xfe, 0xff, 0xff, 0xff, 0x0f};
+
+  TEST_ASSERT_EQUAL_INT(-64, k.read_from(small_src));
+  TEST_ASSERT_EQUAL_INT(2147483647, k.read_from(large_src));
+}
+
+static void key_base_DO_unserialize_several_return_values_EXPECT_matching_tuple() {
+  using namespace upd;
+
+  constexpr auto state_key = kring.get(UPD_CTREF(state_function));
+  constexpr auto pair_key = kring.get(UPD_CTREF(pair_function));
+  auto state = make_tuple(little_endian, twos_complement, int16_t{-300}, uint32_t{0xabcdef}, true);
+  auto pair = make_tuple(little_endian, twos_complement, uint8_t{0x12}, int32_t{-70000});
+
+  std::tuple<int16_t, uint32_t, bool> state_value = state_key.read_from(state.begin());
+  std::pair<uint8_t, int32_t> pair_value = pair_key.read_from(pair.begin());
+
+  TEST_ASSERT_EQUAL_INT16(-300, std::get<0>(state_value));
+  TEST_ASSERT_EQUAL_UINT32(0xabcdef, std::get<1>(state_value));
+  TEST_ASSERT_TRUE(std::get<2>(state_value));
+  TEST_ASSERT_EQUAL_UINT8(0x12, pair_value.first);
+  TEST_ASSERT_EQUAL_INT32(-70000, pair_value.second);
+}
+
+static void key_base_DO_serialize_arguments_in_constant_expression_EXPECT_correct_byte_array_cpp17() {
+#if __cplusplus >= 201703L
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(list, upd::big_endian, upd::ones_complement);
+  constexpr auto k = kring.get(UPD_CTREF(integer_function));
+  constexpr auto packet = k(300, -2, 5).to_array();
+
+  static_assert(packet.size() == k.payload_length, "");
+  static_assert(packet[1] == 0x00 && packet[2] == 0x00 && packet[3] == 0x01 && packet[4] == 0x2c, "");
+  static_assert(packet[5] == 0xff && packet[6] == 0xfd && packet[7] == 0x05, "");
+
+  upd::byte_t dest_buf[k.payload_length];
+  k(300, -2, 5).write_to(dest_buf);
+
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(dest_buf, packet.data(), packet.size());
+#endif // __cplusplus >= 201703L
+}
+
 int main() {
   using namespace upd;
 
@@ -140,5 +213,9 @@ int main() {
   RUN_TEST(key_base_DO_create_key_from_ftor_signature_EXPECT_key_holding_ftor_signature);
   RUN_TEST(key_base_DO_create_key_from_function_using_user_extended_type_EXPECT_correct_behaviour);
   RUN_TEST(key_base_DO_hook_a_callback_EXPECT_callback_receiving_correct_argument);
+  RUN_TEST(key_base_DO_serialize_arguments_with_varint_encoding_EXPECT_leb128_zigzag_byte_sequence);
+  RUN_TEST(key_base_DO_unserialize_data_sequence_with_varint_encoding_EXPECT_correct_value);
+  RUN_TEST(key_base_DO_unserialize_several_return_values_EXPECT_matching_tuple);
+  RUN_TEST(key_base_DO_serialize_arguments_in_constant_expression_EXPECT_correct_byte_array_cpp17);
   return UNITY_END();
 }
@@ -68,11 +68,26 @@ static void keyring_DO_get_an_ikey_by_variable_EXPECT_correct_index_cpp17() {
 #endif // __cplusplus >= 201703L
 }
 
+static void keyring_DO_create_varint_keyring_EXPECT_keys_using_varint_encoding_cpp17() {
+#if __cplusplus >= 201703L
+  using namespace upd;
+
+  constexpr auto ftor_list = flist<function1, ftor1, function2, ftor2, ftor3, function3>;
+  keyring kring{ftor_list, little_endian, twos_complement, varint};
+  auto k = kring.get<function3>();
+
+  static_assert(decltype(kring)::integer_encoding == integer_encoding::VARINT);
+  static_assert(decltype(k)::integer_encoding == integer_encoding::VARINT);
+  TEST_ASSERT_EQUAL_UINT(5, k.index);
+#endif // __cplusplus >= 201703L
+}
+
 int main() {
   UNITY_BEGIN();
   RUN_TEST(keyring_DO_get_an_ikey_EXPECT_correct_index);
   RUN_TEST(keyring_DO_use_make_keyring_EXPECT_correct_behavior);
   RUN_TEST(keyring_DO_get_an_ikey_EXPECT_correct_index_cpp17);
   RUN_TEST(keyring_DO_get_an_ikey_by_variable_EXPECT_correct_index_cpp17);
+  RUN_TEST(keyring_DO_create_varint_keyring_EXPECT_keys_using_varint_encoding_cpp17);
   return UNITY_END();
 }
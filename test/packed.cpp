@@ -0,0 +1,108 @@
+#include <upd/action.hpp>
+#include <upd/key.hpp>
+#include <upd/keyring.hpp>
+#include <upd/packed.hpp>
+#include <upd/tuple.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+enum class mode : uint8_t { IDLE, LOW, HIGH, BLINK };
+
+using flags_t = upd::packed<bool, bool, bool, bool, bool, bool, bool, bool,
+                            bool, bool, bool, bool, bool, bool, bool, bool>;
+using config_t = upd::packed<bool, upd::bits<3, mode>, upd::bits<7>, upd::bits<5>>;
+
+uint16_t count_flags(flags_t flags) {
+  return uint16_t(flags.get<0>() + flags.get<3>() + flags.get<8>() + flags.get<15>());
+}
+config_t toggle(config_t config) {
+  config.set<0>(!config.get<0>());
+  return config;
+}
+
+constexpr auto kring = upd::make_keyring(
+    upd::make_flist(UPD_CTREF(count_flags), UPD_CTREF(toggle)), upd::big_endian, upd::twos_complement);
+
+static void packed_DO_pack_booleans_EXPECT_one_bit_per_field() {
+  static_assert(sizeof(flags_t) == 2, "");
+  static_assert(flags_t::size == 2, "");
+  static_assert(upd::tuple<upd::endianess::LITTLE, upd::signed_mode::TWOS_COMPLEMENT, flags_t, uint8_t>::size == 3, "");
+
+  flags_t flags;
+  flags.set<0>(true);
+  flags.set<9>(true);
+  flags.set<15>(true);
+
+  TEST_ASSERT_EQUAL_UINT8(0x01, flags.begin()[0]);
+  TEST_ASSERT_EQUAL_UINT8(0x82, flags.begin()[1]);
+  TEST_ASSERT_TRUE(flags.get<9>());
+  TEST_ASSERT_FALSE(flags.get<8>());
+}
+
+static void packed_DO_set_fields_spanning_several_bytes_EXPECT_neighbouring_fields_untouched() {
+  static_assert(config_t::width == 16, "");
+
+  config_t config{true, mode::BLINK, 0x55, 0x1f};
+
+  TEST_ASSERT_TRUE(config.get<0>());
+  TEST_ASSERT_TRUE(config.get<1>() == mode::BLINK);
+  TEST_ASSERT_EQUAL_UINT8(0x55, config.get<2>());
+  TEST_ASSERT_EQUAL_UINT8(0x1f, config.get<3>());
+
+  upd::set<2>(config, 0x2a);
+  config.set<1>(mode::LOW);
+
+  TEST_ASSERT_TRUE(upd::get<0>(config));
+  TEST_ASSERT_TRUE(config.get<1>() == mode::LOW);
+  TEST_ASSERT_EQUAL_UINT8(0x2a, config.get<2>());
+  TEST_ASSERT_EQUAL_UINT8(0x1f, config.get<3>());
+}
+
+static void packed_DO_serialize_in_tuple_EXPECT_bytes_ordered_as_an_integer() {
+  using namespace upd;
+
+  config_t config{true, mode::HIGH, 0x7f, 0x10};
+  auto little = make_tuple(little_endian, twos_complement, config, uint8_t{0xaa});
+  auto big = make_tuple(big_endian, twos_complement, config, uint8_t{0xaa});
+
+  TEST_ASSERT_EQUAL_UINT8(config.begin()[0], little[0]);
+  TEST_ASSERT_EQUAL_UINT8(config.begin()[1], little[1]);
+  TEST_ASSERT_EQUAL_UINT8(config.begin()[1], big[0]);
+  TEST_ASSERT_EQUAL_UINT8(config.begin()[0], big[1]);
+  TEST_ASSERT_EQUAL_UINT8(0xaa, big[2]);
+
+  auto result = big.get<0>();
+  TEST_ASSERT_TRUE(result.get<1>() == mode::HIGH);
+  TEST_ASSERT_EQUAL_UINT8(0x7f, result.get<2>());
+  TEST_ASSERT_EQUAL_UINT8(0x10, result.get<3>());
+}
+
+static void packed_DO_call_action_through_key_EXPECT_correct_result() {
+  using namespace upd;
+
+  auto k = kring.get(UPD_CTREF(toggle));
+  action a{toggle, big_endian, twos_complement};
+  byte_t buf[sizeof k.index + config_t::size];
+
+  int i = 0, j = 0, l = 0;
+  k(config_t{false, mode::BLINK, 3, 4}) >> [&](byte_t byte) { buf[i++] = byte; };
+  j = sizeof k.index;
+  a([&]() { return buf[j++]; }, [&](byte_t byte) { buf[l++] = byte; });
+  l = 0;
+  auto result = k << [&]() { return buf[l++]; };
+
+  TEST_ASSERT_TRUE(result.get<0>());
+  TEST_ASSERT_TRUE(result.get<1>() == mode::BLINK);
+  TEST_ASSERT_EQUAL_UINT8(3, result.get<2>());
+  TEST_ASSERT_EQUAL_UINT8(4, result.get<3>());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(packed_DO_pack_booleans_EXPECT_one_bit_per_field);
+  RUN_TEST(packed_DO_set_fields_spanning_several_bytes_EXPECT_neighbouring_fields_untouched);
+  RUN_TEST(packed_DO_serialize_in_tuple_EXPECT_bytes_ordered_as_an_integer);
+  RUN_TEST(packed_DO_call_action_through_key_EXPECT_correct_result);
+  return UNITY_END();
+}
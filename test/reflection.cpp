@@ -0,0 +1,185 @@
+#include <upd/action.hpp>
+#include <upd/key.hpp>
+#include <upd/keyring.hpp>
+#include <upd/tuple.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+#if __cplusplus >= 201703L
+struct padded_t {
+  uint8_t a;
+  uint32_t b;
+  int16_t c;
+};
+
+struct native_t {
+  uint32_t x, y;
+  int32_t z;
+};
+
+struct nested_t {
+  padded_t p;
+  std::array<uint16_t, 3> values;
+  bool flag;
+};
+
+struct extended_t {
+  uint16_t a, b;
+};
+
+template<>
+struct upd_extension<extended_t> {
+  template<typename View_T>
+  static void serialize(const extended_t &o, View_T &view) {
+    view = upd::make_tuple(upd::little_endian, upd::twos_complement, uint16_t(o.a + o.b));
+  }
+
+  static extended_t unserialize(uint16_t sum) { return {sum, 0}; }
+};
+
+struct with_c_array_t {
+  int32_t a[2];
+  int32_t b;
+};
+
+struct derived_t : native_t {
+  int32_t w;
+};
+
+struct empty_base_t {};
+
+struct derived_from_empty_t : empty_base_t {
+  int32_t w;
+};
+
+struct large_t {
+  uint8_t f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16;
+};
+
+struct bit_field_t {
+  uint16_t low : 4;
+  uint16_t high : 12;
+  int8_t c;
+};
+
+static_assert(!upd::detail::is_serializable<with_c_array_t>::value, "");
+static_assert(!upd::detail::is_serializable<derived_t>::value, "");
+static_assert(!upd::detail::is_serializable<derived_from_empty_t>::value, "");
+static_assert(!upd::detail::is_serializable<large_t>::value, "");
+static_assert(upd::detail::is_serializable<bit_field_t>::value, "");
+
+nested_t echo(const nested_t &x) { return x; }
+
+constexpr auto kring = upd::make_keyring(upd::make_flist(UPD_CTREF(echo)), upd::big_endian, upd::ones_complement);
+#endif // __cplusplus >= 201703L
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void reflection_DO_serialize_padded_aggregate_EXPECT_fields_without_padding_cpp17() {
+#if __cplusplus >= 201703L
+  using namespace upd;
+
+  static_assert(detail::serialization_size<padded_t>::value == 7, "");
+
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, padded_t{0x12, 0x3456789a, -5});
+  auto expected =
+      make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, uint8_t{0x12}, 0x3456789au, int16_t{-5});
+
+  TEST_ASSERT_EQUAL_INT(7, t.size);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.begin(), t.begin(), 7);
+
+  auto value = t.template get<0>();
+  TEST_ASSERT_EQUAL_UINT8(0x12, value.a);
+  TEST_ASSERT_EQUAL_UINT32(0x3456789a, value.b);
+  TEST_ASSERT_EQUAL_INT16(-5, value.c);
+#endif // __cplusplus >= 201703L
+}
+
+MAKE_MULTIOPT(reflection_DO_serialize_padded_aggregate_EXPECT_fields_without_padding_cpp17)
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void reflection_DO_serialize_native_aggregate_EXPECT_same_bytes_as_fields_cpp17() {
+#if __cplusplus >= 201703L
+  using namespace upd;
+
+  constexpr auto is_native = detail::has_native_aggregate_layout<Endianess, Signed_Mode, native_t>::value;
+  static_assert(is_native == detail::has_native_representation<Endianess, Signed_Mode, std::int32_t>::value, "");
+
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, native_t{1, 0xabcdef, -300});
+  auto expected = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, 1u, 0xabcdefu, -300);
+
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.begin(), t.begin(), t.size);
+
+  auto value = t.template get<0>();
+  TEST_ASSERT_EQUAL_UINT32(1, value.x);
+  TEST_ASSERT_EQUAL_UINT32(0xabcdef, value.y);
+  TEST_ASSERT_EQUAL_INT32(-300, value.z);
+#endif // __cplusplus >= 201703L
+}
+
+MAKE_MULTIOPT(reflection_DO_serialize_native_aggregate_EXPECT_same_bytes_as_fields_cpp17)
+
+static void reflection_DO_call_action_on_nested_aggregate_EXPECT_same_value_cpp17() {
+#if __cplusplus >= 201703L
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(echo));
+  static_assert(k.payload_length == 1 + 7 + 6 + 1, "");
+
+  no_storage_action a{UPD_CTREF(echo), big_endian, ones_complement};
+  byte_t request[k.payload_length], response[k.payload_length];
+  k(nested_t{{1, 2, -3}, {{4, 5, 6}}, true}).write_to(request);
+  a(request + 1, response);
+  auto value = k.read_from(response);
+
+  TEST_ASSERT_EQUAL_UINT8(1, value.p.a);
+  TEST_ASSERT_EQUAL_UINT32(2, value.p.b);
+  TEST_ASSERT_EQUAL_INT16(-3, value.p.c);
+  TEST_ASSERT_EQUAL_UINT16(6, value.values[2]);
+  TEST_ASSERT_TRUE(value.flag);
+#endif // __cplusplus >= 201703L
+}
+
+static void reflection_DO_serialize_aggregate_with_extension_EXPECT_extension_used_cpp17() {
+#if __cplusplus >= 201703L
+  using namespace upd;
+
+  auto t = make_tuple(little_endian, twos_complement, extended_t{2, 3});
+
+  TEST_ASSERT_EQUAL_INT(2, t.size);
+  TEST_ASSERT_EQUAL_UINT16(5, t.get<0>().a);
+#endif // __cplusplus >= 201703L
+}
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void reflection_DO_serialize_aggregate_with_bit_fields_EXPECT_declared_types_cpp17() {
+#if __cplusplus >= 201703L
+  using namespace upd;
+
+  static_assert(detail::serialization_size<bit_field_t>::value == 5, "");
+
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, bit_field_t{0xa, 0x123, -7});
+  auto expected =
+      make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, uint16_t{0xa}, uint16_t{0x123}, int8_t{-7});
+
+  TEST_ASSERT_EQUAL_INT(5, t.size);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.begin(), t.begin(), 5);
+
+  auto value = t.template get<0>();
+  TEST_ASSERT_EQUAL_UINT16(0xa, value.low);
+  TEST_ASSERT_EQUAL_UINT16(0x123, value.high);
+  TEST_ASSERT_EQUAL_INT8(-7, value.c);
+#endif // __cplusplus >= 201703L
+}
+
+MAKE_MULTIOPT(reflection_DO_serialize_aggregate_with_bit_fields_EXPECT_declared_types_cpp17)
+
+int main() {
+  UNITY_BEGIN();
+  reflection_DO_serialize_padded_aggregate_EXPECT_fields_without_padding_cpp17_multiopt(every_options);
+  reflection_DO_serialize_native_aggregate_EXPECT_same_bytes_as_fields_cpp17_multiopt(every_options);
+  reflection_DO_serialize_aggregate_with_bit_fields_EXPECT_declared_types_cpp17_multiopt(every_options);
+  RUN_TEST(reflection_DO_call_action_on_nested_aggregate_EXPECT_same_value_cpp17);
+  RUN_TEST(reflection_DO_serialize_aggregate_with_extension_EXPECT_extension_used_cpp17);
+  return UNITY_END();
+}
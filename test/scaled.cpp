@@ -0,0 +1,94 @@
+#include <upd/action.hpp>
+#include <upd/key.hpp>
+#include <upd/keyring.hpp>
+#include <upd/scaled.hpp>
+#include <upd/tuple.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+using angle_t = upd::fixed<int16_t, 8>;
+using temperature_t = upd::scaled<uint16_t, std::ratio<1, 100>, std::ratio<-40>>;
+
+angle_t half(angle_t angle, temperature_t) { return angle / 2; }
+
+constexpr auto kring = upd::make_keyring(upd::make_flist(UPD_CTREF(half)), upd::little_endian, upd::twos_complement);
+
+static void scaled_DO_quantize_values_EXPECT_nearest_saturated_representation() {
+  static_assert(sizeof(angle_t) == 2, "");
+  static_assert(std::is_same<angle_t::value_t, float>::value, "");
+  static_assert(std::is_same<upd::fixed<int32_t, 16>::value_t, double>::value, "");
+
+  TEST_ASSERT_EQUAL_INT16(384, angle_t{1.5f}.raw());
+  TEST_ASSERT_EQUAL_INT16(-77, angle_t{-0.3f}.raw());
+  TEST_ASSERT_EQUAL_INT16(32767, angle_t{1000.f}.raw());
+  TEST_ASSERT_EQUAL_INT16(-32768, angle_t{-1000.f}.raw());
+  TEST_ASSERT_EQUAL_FLOAT(-0.30078125f, angle_t{-0.3f});
+
+  TEST_ASSERT_EQUAL_UINT16(6150, temperature_t{21.5f}.raw());
+  TEST_ASSERT_EQUAL_UINT16(0, temperature_t{-50.f}.raw());
+  TEST_ASSERT_EQUAL_FLOAT(21.5f, temperature_t::from_raw(6150));
+}
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void scaled_DO_serialize_in_tuple_EXPECT_integer_representation() {
+  using namespace upd;
+
+  const angle_t angles[] = {0.5f, -1.25f, 127.f, -100.f};
+  const int16_t raws[] = {128, -320, 32512, -25600};
+  auto t = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, temperature_t{0.f}, angles);
+  auto expected = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, uint16_t{4000}, raws);
+
+  TEST_ASSERT_EQUAL_INT(2 + 4 * 2, t.size);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.begin(), t.begin(), t.size);
+
+  auto values = t.template get<1>();
+  for (std::size_t i = 0; i < 4; i++)
+    TEST_ASSERT_EQUAL_INT16(raws[i], values[i].raw());
+  TEST_ASSERT_EQUAL_FLOAT(0.f, t.template get<0>());
+}
+
+MAKE_MULTIOPT(scaled_DO_serialize_in_tuple_EXPECT_integer_representation)
+
+static void scaled_DO_call_action_through_key_EXPECT_floating_point_interface() {
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(half));
+  static_assert(k.payload_length == 1 + 2 + 2, "");
+
+  action a{half, little_endian, twos_complement};
+  byte_t buf[k.payload_length];
+
+  int i = 0, j = 0, l = 0;
+  k(1.5f, 25.f) >> [&](byte_t byte) { buf[i++] = byte; };
+  j = sizeof k.index;
+  a([&]() { return buf[j++]; }, [&](byte_t byte) { buf[l++] = byte; });
+  l = 0;
+  float result = k << [&]() { return buf[l++]; };
+
+  TEST_ASSERT_EQUAL_FLOAT(0.75f, result);
+}
+
+static void scaled_DO_quantize_array_EXPECT_same_values_as_one_by_one() {
+  float values[37], dequantized[37];
+  angle_t quantized[37];
+  for (std::size_t i = 0; i < 37; i++)
+    values[i] = float(i) * 7.3f - 130.f;
+
+  upd::quantize_n(values, quantized, 37);
+  upd::dequantize_n(quantized, dequantized, 37);
+
+  for (std::size_t i = 0; i < 37; i++) {
+    TEST_ASSERT_EQUAL_INT16(angle_t{values[i]}.raw(), quantized[i].raw());
+    TEST_ASSERT_EQUAL_FLOAT(angle_t{values[i]}.value(), dequantized[i]);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(scaled_DO_quantize_values_EXPECT_nearest_saturated_representation);
+  scaled_DO_serialize_in_tuple_EXPECT_integer_representation_multiopt(every_options);
+  RUN_TEST(scaled_DO_call_action_through_key_EXPECT_floating_point_interface);
+  RUN_TEST(scaled_DO_quantize_array_EXPECT_same_values_as_one_by_one);
+  return UNITY_END();
+}
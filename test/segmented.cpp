@@ -0,0 +1,87 @@
+#include <upd/key.hpp>
+#include <upd/keyring.hpp>
+#include <upd/segmented.hpp>
+#include <upd/tuple.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+uint32_t checksum(uint32_t, int16_t);
+
+constexpr auto kring = upd::make_keyring(upd::make_flist(UPD_CTREF(checksum)), upd::big_endian, upd::twos_complement);
+
+template<typename Tuple>
+static upd::segmented_iterator copy_in_ring(const Tuple &t, upd::byte_t (&ring)[16], std::size_t offset) {
+  for (std::size_t i = 0; i < t.size; i++)
+    ring[(offset + i) % sizeof ring] = t[i];
+  return upd::make_ring_iterator(ring, sizeof ring, offset);
+}
+
+static void segmented_iterator_DO_iterate_through_ring_EXPECT_wrapping_sequence() {
+  upd::byte_t ring[16] = {};
+  for (std::size_t i = 0; i < sizeof ring; i++)
+    ring[i] = upd::byte_t(i);
+
+  auto it = upd::make_ring_iterator(ring, sizeof ring, 14);
+  TEST_ASSERT_EQUAL_UINT8(14, *it);
+  TEST_ASSERT_EQUAL_UINT8(15, it[1]);
+  TEST_ASSERT_EQUAL_UINT8(0, it[2]);
+  TEST_ASSERT_EQUAL_UINT8(3, *(it + 5));
+  TEST_ASSERT_EQUAL_INT(2, it.contiguous_size());
+  TEST_ASSERT_EQUAL_INT(14, (it + 2).contiguous_size());
+  TEST_ASSERT_EQUAL_INT(5, (it + 5) - it);
+}
+
+static void segmented_iterator_DO_get_values_from_wrapped_packet_EXPECT_same_values() {
+  using namespace upd;
+
+  const int16_t array[] = {-1, 256, 3};
+  auto t = make_tuple(big_endian, twos_complement, uint32_t{0x12345678}, array, char{'x'});
+
+  for (std::size_t offset = 0; offset < 16; offset++) {
+    upd::byte_t ring[16] = {};
+    auto view = make_view<uint32_t, int16_t[3], char>(big_endian, twos_complement, copy_in_ring(t, ring, offset));
+
+    TEST_ASSERT_EQUAL_UINT32(0x12345678, view.get<0>());
+    TEST_ASSERT_EQUAL_INT16_ARRAY(array, view.get<1>().data(), 3);
+    TEST_ASSERT_EQUAL_INT('x', view.get<2>());
+  }
+}
+
+static void segmented_iterator_DO_set_values_in_wrapped_packet_EXPECT_same_bytes() {
+  using namespace upd;
+
+  const int16_t array[] = {-1, 256, 3};
+  auto t = make_tuple(big_endian, twos_complement, uint32_t{0x12345678}, array, char{'x'});
+
+  for (std::size_t offset = 0; offset < 16; offset++) {
+    upd::byte_t ring[16] = {};
+    auto view = make_view<uint32_t, int16_t[3], char>(
+        big_endian, twos_complement, make_ring_iterator(ring, sizeof ring, offset));
+    view.set<0>(0x12345678);
+    view.set<1>(array);
+    view.set<2>('x');
+
+    for (std::size_t i = 0; i < t.size; i++)
+      TEST_ASSERT_EQUAL_UINT8(t[i], ring[(offset + i) % sizeof ring]);
+  }
+}
+
+static void segmented_iterator_DO_read_response_from_wrapped_packet_EXPECT_same_value() {
+  using namespace upd;
+
+  constexpr auto k = kring.get(UPD_CTREF(checksum));
+  auto t = make_tuple(big_endian, twos_complement, uint32_t{0xdeadbeef});
+  upd::byte_t ring[16] = {};
+
+  TEST_ASSERT_EQUAL_UINT32(0xdeadbeef, k.read_from(copy_in_ring(t, ring, 14)));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(segmented_iterator_DO_iterate_through_ring_EXPECT_wrapping_sequence);
+  RUN_TEST(segmented_iterator_DO_get_values_from_wrapped_packet_EXPECT_same_values);
+  RUN_TEST(segmented_iterator_DO_set_values_in_wrapped_packet_EXPECT_same_bytes);
+  RUN_TEST(segmented_iterator_DO_read_response_from_wrapped_packet_EXPECT_same_value);
+  return UNITY_END();
+}
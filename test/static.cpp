@@ -1,4 +1,7 @@
 #include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
 
 #include <upd/detail/type_traits/iterator_category.hpp>
 #include <upd/detail/type_traits/signature.hpp>
@@ -13,6 +16,12 @@ int main() {
   static_assert(is_input_byte_iterator<const std::uint8_t *>::value, "");
   static_assert(is_output_byte_iterator<std::uint8_t *>::value, "");
   static_assert(!is_output_byte_iterator<const std::uint8_t *>::value, "");
+  static_assert(is_contiguous_byte_iterator<std::uint8_t *>::value, "");
+  static_assert(is_contiguous_byte_iterator<std::vector<std::uint8_t>::iterator>::value, "");
+  static_assert(is_contiguous_byte_iterator<std::vector<std::uint8_t>::const_iterator>::value, "");
+  static_assert(is_contiguous_byte_iterator<std::string::iterator>::value, "");
+  static_assert(!is_contiguous_byte_iterator<std::vector<int>::iterator>::value, "");
+  static_assert(!is_contiguous_byte_iterator<std::list<std::uint8_t>::iterator>::value, "");
   static_assert(!std::is_same<signature_t<decltype(f)>, no_signature>::value, "");
   static_assert(std::is_same<smallest_unsigned_t<(1ull << 8) - 1>, std::uint8_t>::value, "");
   static_assert(std::is_same<smallest_unsigned_t<1ull << 8>, std::uint16_t>::value, "");
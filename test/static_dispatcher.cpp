@@ -0,0 +1,75 @@
+#include <upd/format.hpp>
+#include <upd/key.hpp>
+#include <upd/keyring.hpp>
+#include <upd/static_dispatcher.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+int get_8() { return 8; }
+int get_16() { return 16; }
+int identity(int x) { return x; }
+int last_value = 0;
+void store(int x) { last_value = x; }
+
+constexpr auto ftor_list =
+    upd::make_flist(UPD_CTREF(get_8), UPD_CTREF(get_16), UPD_CTREF(identity), UPD_CTREF(store));
+
+static void static_dispatcher_DO_call_action_EXPECT_calling_correct_action() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, little_endian, twos_complement);
+  constexpr auto dispatcher = make_static_dispatcher(kring);
+  static_assert(std::is_empty<decltype(dispatcher)>::value, "");
+
+  auto function16_index = upd::make_tuple(little_endian, twos_complement, uint8_t{1});
+  auto output = upd::make_tuple<int>(little_endian, twos_complement);
+
+  std::size_t i = 0, j = 0;
+  auto index = dispatcher([&]() { return function16_index[i++]; }, [&](upd::byte_t byte) { output[j++] = byte; });
+
+  TEST_ASSERT_EQUAL_UINT(1, index);
+  TEST_ASSERT_EQUAL_INT(16, output.get<0>());
+}
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void static_dispatcher_DO_process_key_request_EXPECT_same_response_as_action() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{});
+  constexpr auto k = kring.get(UPD_CTREF(identity));
+  static_dispatcher<typename std::decay<decltype(kring)>::type> dispatcher;
+
+  byte_t buf[k.payload_length];
+  k(-1234).write_to(buf);
+  dispatcher(buf, buf);
+
+  TEST_ASSERT_EQUAL_INT(-1234, k.read_from(buf));
+
+  constexpr auto store_key = kring.get(UPD_CTREF(store));
+  store_key(77).write_to(buf);
+  TEST_ASSERT_EQUAL_UINT(3, dispatcher(buf, buf));
+  TEST_ASSERT_EQUAL_INT(77, last_value);
+}
+
+MAKE_MULTIOPT(static_dispatcher_DO_process_key_request_EXPECT_same_response_as_action)
+
+static void static_dispatcher_DO_receive_unknown_index_EXPECT_no_call() {
+  using namespace upd;
+
+  constexpr auto kring = make_keyring(ftor_list, little_endian, twos_complement);
+  auto dispatcher = make_static_dispatcher(kring);
+
+  last_value = 0;
+  byte_t buf[] = {4, 1, 0, 0, 0};
+  TEST_ASSERT_EQUAL_UINT(4, dispatcher(buf, buf));
+  TEST_ASSERT_EQUAL_INT(0, last_value);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(static_dispatcher_DO_call_action_EXPECT_calling_correct_action);
+  static_dispatcher_DO_process_key_request_EXPECT_same_response_as_action_multiopt(every_options);
+  RUN_TEST(static_dispatcher_DO_receive_unknown_index_EXPECT_no_call);
+  return UNITY_END();
+}
@@ -0,0 +1,147 @@
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <upd/buffered_dispatcher.hpp>
+#include <upd/keyring.hpp>
+#include <upd/streaming_dispatcher.hpp>
+#include <upd/unevaluated.hpp>
+
+#include "utility.hpp"
+
+int add(int x, int y) { return x + y; }
+std::uint16_t upload(std::uint32_t, const upd::byte_t (&)[64]) { return 0; }
+void record(std::uint8_t, const std::array<std::int32_t, 10> &) {}
+
+constexpr auto kring = upd::make_keyring(
+    upd::make_flist(UPD_CTREF(add), UPD_CTREF(upload)), upd::little_endian, upd::twos_complement);
+
+constexpr auto varint_kring = upd::make_keyring(
+    upd::make_flist(UPD_CTREF(add), UPD_CTREF(record)), upd::big_endian, upd::twos_complement, upd::varint);
+
+struct upload_handler {
+  void begin(std::uint32_t offset) {
+    this->offset = offset;
+    chunk_sizes.clear();
+    data.clear();
+  }
+
+  void chunk(const upd::byte_t *elements, std::size_t count) {
+    chunk_sizes.push_back(count);
+    data.insert(data.end(), elements, elements + count);
+  }
+
+  std::uint16_t end() {
+    std::uint16_t sum = 0;
+    for (auto byte : data)
+      sum = std::uint16_t(sum + byte);
+    return sum;
+  }
+
+  std::uint32_t offset = 0;
+  std::vector<std::size_t> chunk_sizes;
+  std::vector<upd::byte_t> data;
+};
+
+struct record_handler {
+  void begin(std::uint8_t channel) { this->channel = channel; }
+
+  void chunk(const std::int32_t *elements, std::size_t count) {
+    chunk_count++;
+    values.insert(values.end(), elements, elements + count);
+  }
+
+  void end() { ended = true; }
+
+  std::uint8_t channel = 0;
+  std::size_t chunk_count = 0;
+  std::vector<std::int32_t> values;
+  bool ended = false;
+};
+
+static void streaming_dispatcher_DO_receive_large_array_EXPECT_delivered_by_chunks() {
+  using namespace upd;
+
+  auto dis = make_streaming_dispatcher<16>(kring);
+  constexpr auto upload_key = kring.get(UPD_CTREF(upload));
+
+  using kring_t = typename std::decay<decltype(kring)>::type;
+  using buffered_t = double_buffered_dispatcher<dispatcher<kring_t, action_features::WEAK_REFERENCE>>;
+  static_assert(decltype(dis)::input_buffer_size == 16, "");
+  static_assert(buffered_t::input_buffer_size == 69, "");
+
+  upload_handler handler;
+  dis.set_handler<upload_key.index>(handler);
+
+  byte_t data[64];
+  for (std::size_t i = 0; i < sizeof data; i++)
+    data[i] = byte_t(i * 3);
+
+  std::vector<byte_t> packet;
+  upload_key(0x12345678, data).write_to(std::back_inserter(packet));
+
+  for (std::size_t i = 0; i + 1 < packet.size(); i++)
+    TEST_ASSERT_EQUAL(packet_status::LOADING_PACKET, dis.put(packet[i]));
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis.put(packet.back()));
+
+  TEST_ASSERT_EQUAL_HEX32(0x12345678, handler.offset);
+  TEST_ASSERT_EQUAL_UINT(4, handler.chunk_sizes.size());
+  TEST_ASSERT_EQUAL_UINT(16, handler.chunk_sizes[3]);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(data, handler.data.data(), sizeof data);
+
+  TEST_ASSERT_TRUE(dis.is_loaded());
+  byte_t response[upload_key.payload_length];
+  dis.write_to(response);
+  TEST_ASSERT_EQUAL_UINT16(handler.end(), upload_key.read_from(response));
+}
+
+static void streaming_dispatcher_DO_receive_unhandled_array_EXPECT_dropped_then_next_request_resolved() {
+  using namespace upd;
+
+  auto dis = make_streaming_dispatcher<16>(kring);
+  constexpr auto upload_key = kring.get(UPD_CTREF(upload));
+  constexpr auto add_key = kring.get(UPD_CTREF(add));
+
+  byte_t data[64]{};
+  std::vector<byte_t> packets;
+  upload_key(0, data).write_to(std::back_inserter(packets));
+  add_key(40, 2).write_to(std::back_inserter(packets));
+
+  auto it = packets.cbegin();
+  TEST_ASSERT_EQUAL(packet_status::DROPPED_PACKET, dis.read_from([&]() { return *it++; }));
+  TEST_ASSERT_FALSE(dis.is_loaded());
+
+  byte_t response[add_key.payload_length];
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis([&]() { return *it++; }, response));
+  TEST_ASSERT_TRUE(it == packets.cend());
+  TEST_ASSERT_EQUAL_INT(42, add_key.read_from(response));
+}
+
+static void streaming_dispatcher_DO_receive_varint_array_EXPECT_elements_decoded() {
+  using namespace upd;
+
+  auto dis = make_streaming_dispatcher<4>(varint_kring);
+  constexpr auto record_key = varint_kring.get(UPD_CTREF(record));
+
+  record_handler handler;
+  dis.set_handler<record_key.index>(handler);
+
+  std::array<std::int32_t, 10> values{{0, -1, 300, -70000, 2147483647, -2147483647 - 1, 5, 6, -7, 8}};
+  std::vector<byte_t> packet;
+  record_key(3, values).write_to(std::back_inserter(packet));
+
+  TEST_ASSERT_EQUAL(packet_status::RESOLVED_PACKET, dis.read_from(packet.cbegin()));
+  TEST_ASSERT_EQUAL_UINT8(3, handler.channel);
+  TEST_ASSERT_EQUAL_UINT(3, handler.chunk_count);
+  TEST_ASSERT_EQUAL_INT32_ARRAY(values.data(), handler.values.data(), values.size());
+  TEST_ASSERT_TRUE(handler.ended);
+  TEST_ASSERT_FALSE(dis.is_loaded());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(streaming_dispatcher_DO_receive_large_array_EXPECT_delivered_by_chunks);
+  RUN_TEST(streaming_dispatcher_DO_receive_unhandled_array_EXPECT_dropped_then_next_request_resolved);
+  RUN_TEST(streaming_dispatcher_DO_receive_varint_array_EXPECT_elements_decoded);
+  return UNITY_END();
+}
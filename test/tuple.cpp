@@ -176,6 +176,36 @@ void tuple_DO_invoke_function_EXPECT_correct_behavior() {
   TEST_ASSERT_EQUAL_INT(12 + 34 - 56, terms.invoke(*(+[](int a, int b, int c) { return a + b + c; })));
 }
 
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+void tuple_DO_invoke_function_on_integers_and_arrays_EXPECT_same_values() {
+  using namespace upd;
+
+  int16_t array[]{-0x1234, 0x5678, -0x7abc};
+  tuple<Endianess, Signed_Mode, uint8_t, int32_t, int16_t[3], uint64_t> t{0xab, -0x12345678, array, 0x123456789abc};
+
+  t.invoke([&](uint8_t a, int32_t b, const int16_t(&c)[3], uint64_t d) {
+    TEST_ASSERT_EQUAL_HEX8(0xab, a);
+    TEST_ASSERT_EQUAL_INT32(-0x12345678, b);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(array, c, 3);
+    TEST_ASSERT_EQUAL_HEX64(0x123456789abc, d);
+  });
+}
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+void tuple_DO_invoke_function_on_floating_points_EXPECT_same_values() {
+  using namespace upd;
+
+  float samples[]{0.25f, -1e-3f, 3.5e12f, -0.0f};
+  tuple<Endianess, Signed_Mode, float, int16_t, double, float[4]> t{-1.5f, -0x123, 6.02214076e23, samples};
+
+  t.invoke([&](float a, int16_t b, double c, const float(&d)[4]) {
+    TEST_ASSERT_TRUE(a == -1.5f);
+    TEST_ASSERT_EQUAL_INT16(-0x123, b);
+    TEST_ASSERT_TRUE(c == 6.02214076e23);
+    TEST_ASSERT_EQUAL_MEMORY(samples, d, sizeof samples);
+  });
+}
+
 template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
 void tuple_DO_make_empty_tuple_EXPECT_valid_object() {
   using namespace upd;
@@ -204,6 +234,21 @@ static void tuple_DO_bind_names_to_tuple_element_EXPECT_getting_same_values_cpp1
 #endif // __cplusplus >= 201703L
 }
 
+static void tuple_DO_construct_in_constant_expression_EXPECT_same_values_cpp17() {
+#if __cplusplus >= 201703L
+  using namespace upd;
+
+  constexpr auto t = make_tuple(big_endian, twos_complement, short{-2}, 0x12345678u, char{8});
+
+  static_assert(t[0] == 0xff && t[1] == 0xfe, "");
+  static_assert(t[2] == 0x12 && t[3] == 0x34 && t[4] == 0x56 && t[5] == 0x78, "");
+  static_assert(t.get<0>() == -2 && t.get<1>() == 0x12345678u && t.get<2>() == 8, "");
+
+  auto runtime_t = make_tuple(big_endian, twos_complement, short{-2}, 0x12345678u, char{8});
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(runtime_t.begin(), t.begin(), t.size);
+#endif // __cplusplus >= 201703L
+}
+
 static void tuple_DO_serialize_user_provided_structure_EXCEPT_correct_behavior() {
   using namespace upd;
 
@@ -231,6 +276,15 @@ static void tuple_view_DO_iterate_subview_EXPECT_exact_subsequence() {
     TEST_ASSERT_EQUAL_UINT8(*e_seq++, byte);
 }
 
+static void tuple_DO_unserialize_non_canonical_bool_EXPECT_true() {
+  using namespace upd;
+
+  auto t = make_tuple(little_endian, twos_complement, bool{});
+  t[0] = 0x02;
+
+  TEST_ASSERT_TRUE(t.get<0>());
+}
+
 static void tuple_DO_serialize_std_array() {
   using namespace upd;
 
@@ -240,11 +294,26 @@ static void tuple_DO_serialize_std_array() {
   TEST_ASSERT_EQUAL_INT_ARRAY(expected, get<0>(t).data(), 4);
 }
 
+static void tuple_DO_fill_uninitialized_storage_EXPECT_values_from_written_bytes() {
+  using namespace upd;
+
+  auto expected = make_tuple(little_endian, twos_complement, uint16_t{0xabcd}, std::array<int16_t, 3>{-1, 2, -3});
+  tuple<endianess::LITTLE, signed_mode::TWOS_COMPLEMENT, uint16_t, int16_t[3]> t{uninitialized};
+  for (std::size_t i = 0; i < t.size; i++)
+    t[i] = expected[i];
+
+  int16_t expected_array[] = {-1, 2, -3};
+  TEST_ASSERT_EQUAL_HEX16(0xabcd, t.get<0>());
+  TEST_ASSERT_EQUAL_INT16_ARRAY(expected_array, t.get<1>().data(), 3);
+}
+
 MAKE_MULTIOPT(tuple_DO_set_value_EXPECT_same_value_with_get)
 MAKE_MULTIOPT(tuple_DO_set_array_EXPECT_same_value_with_get)
 MAKE_MULTIOPT(tuple_DO_iterate_throught_content_EXPECT_correct_raw_data)
 MAKE_MULTIOPT(tuple_DO_access_like_array_EXPECT_correct_raw_values)
 MAKE_MULTIOPT(tuple_DO_invoke_function_EXPECT_correct_behavior)
+MAKE_MULTIOPT(tuple_DO_invoke_function_on_integers_and_arrays_EXPECT_same_values)
+MAKE_MULTIOPT(tuple_DO_invoke_function_on_floating_points_EXPECT_same_values)
 MAKE_MULTIOPT(tuple_DO_make_empty_tuple_EXPECT_valid_object)
 
 int main() {
@@ -266,12 +335,17 @@ int main() {
   tuple_DO_iterate_throught_content_EXPECT_correct_raw_data_multiopt(every_options);
   tuple_DO_access_like_array_EXPECT_correct_raw_values_multiopt(every_options);
   tuple_DO_invoke_function_EXPECT_correct_behavior_multiopt(every_options);
+  tuple_DO_invoke_function_on_integers_and_arrays_EXPECT_same_values_multiopt(every_options);
+  tuple_DO_invoke_function_on_floating_points_EXPECT_same_values_multiopt(every_options);
   tuple_DO_make_empty_tuple_EXPECT_valid_object_multiopt(every_options);
 
   UNITY_BEGIN();
   RUN_TEST(tuple_DO_bind_names_to_tuple_element_EXPECT_getting_same_values_cpp17);
+  RUN_TEST(tuple_DO_construct_in_constant_expression_EXPECT_same_values_cpp17);
   RUN_TEST(tuple_DO_serialize_user_provided_structure_EXCEPT_correct_behavior);
   RUN_TEST(tuple_DO_serialize_std_array);
+  RUN_TEST(tuple_DO_fill_uninitialized_storage_EXPECT_values_from_written_bytes);
+  RUN_TEST(tuple_DO_unserialize_non_canonical_bool_EXPECT_true);
   RUN_TEST(tuple_view_DO_iterate_subview_EXPECT_exact_subsequence);
   return UNITY_END();
 }
@@ -0,0 +1,86 @@
+#include <upd/tuple.hpp>
+#include <upd/tuple_array.hpp>
+
+#include "utility.hpp"
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void tuple_array_DO_extract_column_EXPECT_values_of_every_record() {
+  using namespace upd;
+
+  tuple_array<8, Endianess, Signed_Mode, uint32_t, int16_t[2], char> records;
+  for (std::size_t i = 0; i < records.size(); i++) {
+    const int16_t array[] = {int16_t(-int16_t(i)), int16_t(i * 100)};
+    auto record = records[i];
+    record.template set<0>(uint32_t(i << 20));
+    record.template set<1>(array);
+    record.template set<2>(char(i));
+  }
+
+  uint32_t column0[8];
+  std::array<int16_t, 2> column1[8];
+  char column2[8];
+  records.template column<0>(column0);
+  records.template column<1>(column1);
+  records.template column<2>(column2);
+
+  for (std::size_t i = 0; i < records.size(); i++) {
+    TEST_ASSERT_EQUAL_UINT32(i << 20, column0[i]);
+    TEST_ASSERT_EQUAL_INT(-int(i), column1[i][0]);
+    TEST_ASSERT_EQUAL_INT(i * 100, column1[i][1]);
+    TEST_ASSERT_EQUAL_INT(i, column2[i]);
+  }
+}
+
+MAKE_MULTIOPT(tuple_array_DO_extract_column_EXPECT_values_of_every_record)
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void tuple_array_DO_assign_column_EXPECT_same_bytes_as_tuples() {
+  using namespace upd;
+
+  tuple_array<8, Endianess, Signed_Mode, int32_t, uint8_t> records;
+  int32_t column0[8];
+  uint8_t column1[8];
+  for (std::size_t i = 0; i < records.size(); i++) {
+    column0[i] = int32_t(i * 1000) - 4000;
+    column1[i] = uint8_t(i);
+  }
+
+  records.template assign_column<0>(column0);
+  records.template assign_column<1>(column1);
+
+  for (std::size_t i = 0; i < records.size(); i++) {
+    auto expected = make_tuple(endianess_h<Endianess>{}, signed_mode_h<Signed_Mode>{}, column0[i], column1[i]);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.begin(), records.begin() + i * records.stride, records.stride);
+  }
+}
+
+MAKE_MULTIOPT(tuple_array_DO_assign_column_EXPECT_same_bytes_as_tuples)
+
+static void tuple_array_DO_bind_to_external_buffer_EXPECT_records_in_buffer() {
+  using namespace upd;
+
+  upd::byte_t buf[3 * 6] = {};
+  auto records = make_tuple_array<uint16_t, float>(little_endian, twos_complement, buf, 3);
+  const float column1[] = {0.5f, -1.25f, 3.0f};
+  records.assign_column<1>(column1);
+  records[1].set<0>(0xabcd);
+
+  TEST_ASSERT_EQUAL_INT(3, records.size());
+  TEST_ASSERT_EQUAL_UINT8(0xcd, buf[6]);
+  TEST_ASSERT_EQUAL_UINT8(0xab, buf[7]);
+  TEST_ASSERT_TRUE(records[2].get<1>() == 3.0f);
+
+  uint16_t column0[3];
+  records.column<0>(column0);
+  TEST_ASSERT_EQUAL_UINT16(0, column0[0]);
+  TEST_ASSERT_EQUAL_UINT16(0xabcd, column0[1]);
+  TEST_ASSERT_EQUAL_UINT16(0, column0[2]);
+}
+
+int main() {
+  UNITY_BEGIN();
+  tuple_array_DO_extract_column_EXPECT_values_of_every_record_multiopt(every_options);
+  tuple_array_DO_assign_column_EXPECT_same_bytes_as_tuples_multiopt(every_options);
+  RUN_TEST(tuple_array_DO_bind_to_external_buffer_EXPECT_records_in_buffer);
+  return UNITY_END();
+}
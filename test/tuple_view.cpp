@@ -1,3 +1,6 @@
+#include <string>
+#include <vector>
+
 #include <upd/tuple.hpp>
 
 #include "utility.hpp"
@@ -83,6 +86,33 @@ static void tuple_view_DO_bind_to_a_forward_list_EXPECT_correct_behavior() {
   TEST_ASSERT_EQUAL_HEX8(0xabc, tview.get<1>());
 }
 
+static void tuple_view_DO_bind_to_contiguous_containers_EXPECT_same_content_as_plain_pointer() {
+  using namespace upd;
+
+  constexpr std::size_t size = sizeof(uint16_t) + sizeof(int32_t) + sizeof(uint8_t);
+
+  std::vector<byte_t> vector(size + 1);
+  std::string string(size + 1, '\0');
+  byte_t expected[size];
+
+  auto vector_view = make_view<uint16_t, int32_t, uint8_t>(little_endian, twos_complement, vector.begin() + 1);
+  auto string_view = make_view<uint16_t, int32_t, uint8_t>(big_endian, ones_complement, string.begin() + 1);
+  vector_view = make_tuple(little_endian, twos_complement, uint16_t{0xabc}, int32_t{-0xdef}, uint8_t{0x12});
+  string_view.set<1>(-0xdef);
+  make_view<uint16_t, int32_t, uint8_t>(little_endian, twos_complement, (byte_t *)expected) =
+      make_tuple(little_endian, twos_complement, uint16_t{0xabc}, int32_t{-0xdef}, uint8_t{0x12});
+
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, vector.data() + 1, size);
+  TEST_ASSERT_EQUAL_INT(-0xdef, string_view.get<1>());
+  TEST_ASSERT_EQUAL_INT(-0xdef, (detail::read_as<int32_t, endianess::LITTLE, signed_mode::TWOS_COMPLEMENT>(
+                                    static_cast<const std::vector<byte_t> &>(vector).begin(), 3)));
+  vector_view.invoke([](uint16_t a, int32_t b, uint8_t c) {
+    TEST_ASSERT_EQUAL_HEX16(0xabc, a);
+    TEST_ASSERT_EQUAL_INT(-0xdef, b);
+    TEST_ASSERT_EQUAL_HEX8(0x12, c);
+  });
+}
+
 static void tuple_view_DO_assign_to_a_tuple_EXPECT_correct_behavior() {
   using namespace upd;
 
@@ -114,6 +144,7 @@ int main() {
   RUN_TEST(tuple_view_DO_bind_to_buffer_EXPECT_reading_correct_value);
   RUN_TEST(tuple_view_DO_set_value_EXPECT_reading_same_value);
   RUN_TEST(tuple_view_DO_bind_to_a_forward_list_EXPECT_correct_behavior);
+  RUN_TEST(tuple_view_DO_bind_to_contiguous_containers_EXPECT_same_content_as_plain_pointer);
   RUN_TEST(tuple_view_DO_assign_to_a_tuple_EXPECT_correct_behavior);
   return UNITY_END();
 }
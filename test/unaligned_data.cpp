@@ -1,3 +1,5 @@
+#include <limits>
+
 #include <upd/detail/serialization.hpp>
 
 #include "utility.hpp"
@@ -27,7 +29,84 @@ static void unaligned_data_DO_serialize_data_EXPECT_correct_value_when_unseriali
   TEST_ASSERT_EQUAL_HEX64_MESSAGE(-0xabc, (detail::read_as<int, Endianess, Signed_Mode>(buf + sizeof(int))), error_msg);
 }
 
+static void unaligned_data_DO_serialize_floating_point_EXPECT_ieee754_raw_data() {
+  using namespace upd;
+
+  byte_t buf[1 + sizeof(double)];
+  const byte_t float_le[] = {0x00, 0x00, 0xc0, 0x3f}, float_be[] = {0x3f, 0xc0, 0x00, 0x00};
+  const byte_t double_le[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0};
+  const byte_t double_be[] = {0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+  detail::write_as<endianess::LITTLE, signed_mode::ONES_COMPLEMENT>(1.5f, buf + 1);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(float_le, buf + 1, sizeof float_le);
+  TEST_ASSERT_TRUE((detail::read_as<float, endianess::LITTLE, signed_mode::ONES_COMPLEMENT>(buf + 1) == 1.5f));
+  detail::write_as<endianess::BIG, signed_mode::TWOS_COMPLEMENT>(1.5f, buf + 1);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(float_be, buf + 1, sizeof float_be);
+  TEST_ASSERT_TRUE((detail::read_as<float, endianess::BIG, signed_mode::TWOS_COMPLEMENT>(buf + 1) == 1.5f));
+  detail::write_as<endianess::LITTLE, signed_mode::TWOS_COMPLEMENT>(-2.0, buf + 1);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(double_le, buf + 1, sizeof double_le);
+  TEST_ASSERT_TRUE((detail::read_as<double, endianess::LITTLE, signed_mode::TWOS_COMPLEMENT>(buf + 1) == -2.0));
+  detail::write_as<endianess::BIG, signed_mode::OFFSET_BINARY>(-2.0, buf + 1);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(double_be, buf + 1, sizeof double_be);
+  TEST_ASSERT_TRUE((detail::read_as<double, endianess::BIG, signed_mode::OFFSET_BINARY>(buf + 1) == -2.0));
+}
+
+template<typename Int, upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise() {
+  using namespace upd;
+
+  constexpr std::size_t size = 67;
+  Int array[size];
+  byte_t expected_data[size * sizeof(Int)], buf[size * sizeof(Int) + 1];
+
+  for (std::size_t i = 0; i < size; i++) {
+    array[i] = static_cast<Int>((i % 2 ? -1 : 1) * static_cast<long long>(i * 0x01020304050607));
+    detail::write_as<Endianess, Signed_Mode>(array[i], expected_data + i * sizeof(Int));
+  }
+
+  detail::write_as<Endianess, Signed_Mode>(array, buf + 1);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_data, buf + 1, sizeof expected_data);
+
+  auto result = detail::read_as<Int[size], Endianess, Signed_Mode>(buf + 1);
+  for (std::size_t i = 0; i < size; i++)
+    TEST_ASSERT_TRUE(array[i] == result[i]);
+}
+
+template<upd::endianess Endianess, upd::signed_mode Signed_Mode>
+static void unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise() {
+  unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise<int16_t, Endianess, Signed_Mode>();
+  unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise<uint16_t, Endianess, Signed_Mode>();
+  unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise<int32_t, Endianess, Signed_Mode>();
+  unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise<uint32_t, Endianess, Signed_Mode>();
+  unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise<int64_t, Endianess, Signed_Mode>();
+  unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise<uint64_t, Endianess, Signed_Mode>();
+  unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise<float, Endianess, Signed_Mode>();
+  unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise<double, Endianess, Signed_Mode>();
+}
+
+template<typename Int, upd::signed_mode Signed_Mode>
+static void unaligned_data_DO_convert_every_value_EXPECT_same_value() {
+  using namespace upd;
+
+  // Signed magnitude and ones' complement cannot represent the smallest two's complement value
+  auto min = Signed_Mode == signed_mode::SIGNED_MAGNITUDE || Signed_Mode == signed_mode::ONES_COMPLEMENT
+                 ? static_cast<long>(std::numeric_limits<Int>::min()) + 1
+                 : static_cast<long>(std::numeric_limits<Int>::min());
+
+  for (auto value = min; value <= std::numeric_limits<Int>::max(); value++) {
+    auto raw = detail::to_signed_mode_impl<Signed_Mode>(static_cast<Int>(value));
+    TEST_ASSERT_EQUAL_INT64(value, (detail::from_signed_mode_impl<Int, Signed_Mode>(raw)));
+  }
+}
+
+template<upd::signed_mode Signed_Mode>
+static void unaligned_data_DO_convert_every_value_EXPECT_same_value() {
+  unaligned_data_DO_convert_every_value_EXPECT_same_value<int8_t, Signed_Mode>();
+  unaligned_data_DO_convert_every_value_EXPECT_same_value<int16_t, Signed_Mode>();
+}
+
 MAKE_MULTIOPT(unaligned_data_DO_serialize_data_EXPECT_correct_value_when_unserializing)
+MAKE_MULTIOPT(unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise)
 
 int main() {
   using namespace upd;
@@ -131,6 +210,12 @@ int main() {
                                                                      0x75,
                                                                      0x44>));
 
+  RUN_TEST(unaligned_data_DO_serialize_floating_point_EXPECT_ieee754_raw_data);
+  RUN_TEST(unaligned_data_DO_convert_every_value_EXPECT_same_value<signed_mode::SIGNED_MAGNITUDE>);
+  RUN_TEST(unaligned_data_DO_convert_every_value_EXPECT_same_value<signed_mode::ONES_COMPLEMENT>);
+  RUN_TEST(unaligned_data_DO_convert_every_value_EXPECT_same_value<signed_mode::TWOS_COMPLEMENT>);
+  RUN_TEST(unaligned_data_DO_convert_every_value_EXPECT_same_value<signed_mode::OFFSET_BINARY>);
   unaligned_data_DO_serialize_data_EXPECT_correct_value_when_unserializing_multiopt(every_options);
+  unaligned_data_DO_serialize_array_EXPECT_same_raw_data_as_element_wise_multiopt(every_options);
   return UNITY_END();
 }